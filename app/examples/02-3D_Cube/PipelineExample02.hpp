@@ -32,11 +32,13 @@ namespace examples {
 				beginRenderPass(0);
 					beginRenderSubPass(0);
 						for (auto &chunk: scene.getActiveChunks()) {
-							uint32_t iterator = 0;
-							for (auto &go: chunk.second->getGameObjects()) {
-								// If no mesh or material, continue
-								auto mesh = go->getModule<scene::MeshRendererModule>();
-								if (!go->active || mesh == nullptr || mesh->getMesh() == nullptr || mesh->getMaterial() == nullptr)
+							if (!chunk.second->hasBuffers())
+								continue;
+							for (auto &entry: chunk.second->getComponents().getMeshRenderers()) {
+								// If no mesh or material, or drawn by the chunk static geometry, continue
+								auto mesh = entry.meshRenderer;
+								if (!entry.gameObject->active || mesh->getMesh() == nullptr || mesh->getMaterial() == nullptr
+										|| chunk.second->getStaticGeometry().isBaked(entry.objectSlot))
 									continue;
 
 								// Bind sets
@@ -45,7 +47,15 @@ namespace examples {
 								mesh->getMesh()->bind(commandBuffer); // object
 
 								// Draw
-								mesh->getMesh()->render(iterator++);
+								mesh->getMesh()->render(entry.objectSlot);
+							}
+
+							// Draw static geometry clusters
+							for (auto &cluster: chunk.second->getStaticGeometry().getClusters()) {
+								chunk.second->bind(commandBuffer, cluster.material);
+								cluster.material->bind(commandBuffer);
+								cluster.mesh->bind(commandBuffer);
+								cluster.mesh->render(cluster.objectSlot);
 							}
 						}
 					endRenderSubPass();
@@ -47,11 +47,11 @@ namespace examples {
 					beginRenderSubPass(0);
 						// Cull for every chunk
 						for (auto& c : scene.getActiveChunks()) {
-							if (c.second->getGameObjects().empty())
+							if (c.second->getGameObjects().empty() || !c.second->hasBuffers())
 								continue;
 
 							// Do culling
-							_cullingManager->createBatches(c.second->getGameObjects());
+							_cullingManager->createBatches(*c.second);
 
 							if (scene.getActiveCamera() != nullptr && scene.getActiveCamera()->name == "Editor Camera")
 								_cullingManager->cull(scene.getFirstGameCamera(), *c.second);
@@ -4,7 +4,7 @@
 #include "examples/04-Indirect_Culling/EngineInstanceExample04.hpp"
 #include "examples/05-Terrain/EngineInstanceExample05.hpp"
 
-int main() {
+int main(int argc, char* argv[]) {
 	// === EXAMPLES ===
 	{
 		// 01 - Triangle
@@ -21,7 +21,7 @@ int main() {
 
 		// 04 - Indirect Culling
 		examples::EngineInstanceExample04 instance04 {};
-		instance04.startInstance();
+		instance04.startInstance(argc, argv);
 
 		// 05 - Terrain
 		//examples::EngineInstanceExample05 instance05 {};
@@ -5,6 +5,7 @@
 #include "WdeGUI/WdeGUI.hpp"
 #include "WdeCore/Core/WdeInstance.hpp"
 #include "WdeCommon/WdeUtils/FPSUtils.hpp"
+#include "WdeCommon/WdeUtils/SimulationClock.hpp"
 #include "WdeScene/WdeScene.hpp"
 #include "WdeInput/InputManager.hpp"
 #include "WdeRender/descriptors/DescriptorBuilder.hpp"
@@ -33,6 +34,12 @@ namespace wde {
 				logger::log(LogLevel::INFO, LogChannel::CORE) << "======== Initializing program ========" << logger::endl;
 				logger::log(LogLevel::INFO, LogChannel::CORE) << "Initializing program." << logger::endl;
 
+				// Simulation only, without window or render device
+				if (Config::HEADLESS) {
+					startHeadless(instance);
+					return;
+				}
+
 				// Setup
 				WDE_PROFILE_BEGIN_SESSION("Initialization", "logs/profiler_init.json");
 				// ===== CREATE MODULE SUBJECT =====
@@ -128,7 +135,14 @@ namespace wde {
 						_input->tick();
 						_render->tick();
 						_gui->tick();
-						_physics->tick();
+
+						// Simulate with fixed steps, as many as the elapsed time requires
+						logger::log(LogLevel::INFO, LogChannel::CORE) << "Simulating fixed steps." << logger::endl;
+						_clock.update();
+						while (_clock.step()) {
+							_physics->tick();
+							instance.simulateInstance(_clock.getStepTime());
+						}
 
 						logger::log(LogLevel::INFO, LogChannel::CORE) << "Ticking for engine instance." << logger::endl;
 						instance.tickInstance();
@@ -190,9 +204,109 @@ namespace wde {
 			input::InputManager& getInput() { return *_input; }
 			resource::WdeResourceManager& getResourceManager() { return *_resourceManager; }
 			physics::WdePhysics& getPhysics() { return *_physics; }
+			/** @return The fixed step simulation clock */
+			const SimulationClock& getClock() const { return _clock; }
 
 
 		private:
+			/**
+			 * Runs the scene simulation without the render and GUI modules (Config::HEADLESS)
+			 * @param instance
+			 */
+			void startHeadless(WdeInstance& instance) {
+				// Setup
+				WDE_PROFILE_BEGIN_SESSION("Initialization", "logs/profiler_init.json");
+				_subject = std::make_shared<core::Subject>("core Subject");
+
+				// Input manager core (no key is pressed without a window)
+				_input = std::make_shared<input::InputManager>();
+
+				// Physics Manager
+				_physics = std::make_shared<physics::WdePhysics>(_subject);
+				_subject->addObserver(_physics);
+
+				// Scene core
+				_scene = std::make_shared<scene::WdeScene>(_subject);
+				_subject->addObserver(_scene);
+
+				// Resource Manager (only the resources descriptions are loaded)
+				_resourceManager = std::make_shared<resource::WdeResourceManager>(_subject);
+				_subject->addObserver(_resourceManager);
+
+				// Initialize instance and load scene
+				logger::log(LogLevel::INFO, LogChannel::CORE) << "Initializing engine instance in headless mode." << logger::endl;
+				instance.initialize();
+				_scene->loadScene();
+
+				logger::log(LogLevel::INFO, LogChannel::CORE) << "======== End of initialization ========" << logger::endl << logger::endl;
+				WDE_PROFILE_END_SESSION();
+
+				// Run
+				WDE_PROFILE_BEGIN_SESSION("Running", "logs/profiler_run.json");
+				std::cout << "Starting engine in headless mode." << std::endl;
+				double simulationTime = 0.0; // Time spent in the simulation steps only (the frame ticks are timed apart)
+				auto simulateStep = [&](float stepTime) {
+					auto stepStartTime = std::chrono::steady_clock::now();
+					_physics->tick();
+					instance.simulateInstance(stepTime);
+					simulationTime += std::chrono::duration<double>(std::chrono::steady_clock::now() - stepStartTime).count();
+				};
+				uint64_t stepsCount = 0;
+				auto startTime = std::chrono::steady_clock::now();
+				while (Config::HEADLESS_STEPS_COUNT <= 0 || stepsCount < static_cast<uint64_t>(Config::HEADLESS_STEPS_COUNT)) {
+					WDE_PROFILE_SCOPE("wde::WaterDropEngine::tickHeadless()");
+
+					// Simulate a step as fast as possible when the steps count is given, else in real time
+					uint64_t lastStepsCount = stepsCount;
+					if (Config::HEADLESS_STEPS_COUNT > 0) {
+						simulateStep(_clock.getStepTime());
+						stepsCount++;
+					}
+					else {
+						_clock.update();
+						for (; _clock.step(); stepsCount++)
+							simulateStep(_clock.getStepTime());
+					}
+					if (stepsCount == lastStepsCount) {
+						std::this_thread::sleep_for(std::chrono::milliseconds(1));
+						continue;
+					}
+
+					// Tick
+					logger::log(LogLevel::INFO, LogChannel::CORE) << "Ticking for engine instance." << logger::endl;
+					instance.tickInstance();
+					_scene->tick();
+					_resourceManager->tick();
+					logger::log(LogLevel::INFO, LogChannel::CORE) << "====== End of tick. ======\n\n" << logger::endl;
+				}
+				double elapsedTime = std::chrono::duration<double>(std::chrono::steady_clock::now() - startTime).count();
+				std::cout << "Simulated " << stepsCount << " steps in " << simulationTime << " s ("
+						  << static_cast<double>(stepsCount) / std::max(simulationTime, 1e-9) << " steps per second), "
+						  << elapsedTime << " s with the frame ticks (" << static_cast<double>(stepsCount) / std::max(elapsedTime, 1e-9)
+						  << " steps and ticks per second)." << std::endl;
+				WDE_PROFILE_END_SESSION();
+
+
+				// Clean up WaterDropEngine
+				WDE_PROFILE_BEGIN_SESSION("Cleaning Up", "logs/profiler_cleanup.json");
+				logger::log(LogLevel::INFO, LogChannel::CORE) << "======== Cleaning up modules ========" << logger::endl;
+				instance.cleanUpInstance();
+
+				_input.reset();
+				_resourceManager->cleanUp();
+				_scene->cleanUp();
+				_physics->cleanUp();
+
+				logger::log(LogLevel::INFO, LogChannel::CORE) << "======== Cleaning up ended ========" << logger::endl;
+				_subject.reset();
+
+				// Clean up core and logger
+				logger::log(LogLevel::INFO, LogChannel::CORE) << "Closing program." << logger::endl;
+				WDE_PROFILE_END_SESSION();
+				logger::LoggerHandler::cleanUp();
+			}
+
+
 			// Modules
 			std::shared_ptr<render::WdeRender> _render;
 			std::shared_ptr<gui::WdeGUI> _gui;
@@ -201,6 +315,9 @@ namespace wde {
 			std::shared_ptr<resource::WdeResourceManager> _resourceManager;
 			std::shared_ptr<physics::WdePhysics> _physics;
 
+			// Fixed step simulation clock
+			SimulationClock _clock {};
+
 			// Modules communication subject
 			std::shared_ptr<core::Subject> _subject;
 
@@ -0,0 +1,76 @@
+#include "MappedFile.hpp"
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace wde {
+	MappedFile::MappedFile(const std::string& fileName) {
+		WDE_PROFILE_FUNCTION();
+		logger::log(LogLevel::DEBUG, LogChannel::COMMON) << "Mapping file " << fileName << logger::endl;
+
+#ifdef _WIN32
+		// Open file
+		_file = CreateFileA(fileName.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+		if (_file == INVALID_HANDLE_VALUE)
+			throw WdeException(LogChannel::COMMON, "Failed to open file '" + fileName + "'.");
+
+		LARGE_INTEGER fileSize;
+		if (!GetFileSizeEx(_file, &fileSize) || fileSize.QuadPart == 0) {
+			CloseHandle(_file);
+			throw WdeException(LogChannel::COMMON, "Cannot map empty file '" + fileName + "'.");
+		}
+		_size = static_cast<size_t>(fileSize.QuadPart);
+
+		// Map file
+		_mapping = CreateFileMappingA(_file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+		if (_mapping == nullptr) {
+			CloseHandle(_file);
+			throw WdeException(LogChannel::COMMON, "Failed to map file '" + fileName + "'.");
+		}
+		_data = static_cast<const char*>(MapViewOfFile(_mapping, FILE_MAP_READ, 0, 0, 0));
+		if (_data == nullptr) {
+			CloseHandle(_mapping);
+			CloseHandle(_file);
+			throw WdeException(LogChannel::COMMON, "Failed to map file '" + fileName + "'.");
+		}
+#else
+		// Open file
+		_file = open(fileName.c_str(), O_RDONLY);
+		if (_file < 0)
+			throw WdeException(LogChannel::COMMON, "Failed to open file '" + fileName + "'.");
+
+		struct stat fileStat {};
+		if (fstat(_file, &fileStat) != 0 || fileStat.st_size == 0) {
+			close(_file);
+			throw WdeException(LogChannel::COMMON, "Cannot map empty file '" + fileName + "'.");
+		}
+		_size = static_cast<size_t>(fileStat.st_size);
+
+		// Map file
+		void* data = mmap(nullptr, _size, PROT_READ, MAP_PRIVATE, _file, 0);
+		if (data == MAP_FAILED) {
+			close(_file);
+			throw WdeException(LogChannel::COMMON, "Failed to map file '" + fileName + "'.");
+		}
+		_data = static_cast<const char*>(data);
+#endif
+	}
+
+	MappedFile::~MappedFile() {
+		WDE_PROFILE_FUNCTION();
+#ifdef _WIN32
+		UnmapViewOfFile(_data);
+		CloseHandle(_mapping);
+		CloseHandle(_file);
+#else
+		munmap(const_cast<char*>(_data), _size);
+		close(_file);
+#endif
+		_data = nullptr;
+		_size = 0;
+	}
+}
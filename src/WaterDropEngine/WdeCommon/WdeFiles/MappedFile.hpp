@@ -0,0 +1,40 @@
+#pragma once
+
+#include "../../../wde.hpp"
+
+namespace wde {
+	/**
+	 * Read-only view of a file mapped in memory
+	 */
+	class MappedFile : public NonCopyable {
+		public:
+			/**
+			 * Maps the given file in memory
+			 * @param fileName The path of the file from the root of the project
+			 */
+			explicit MappedFile(const std::string& fileName);
+			~MappedFile() override;
+
+
+			// Getters
+			/** @return The mapped file content */
+			const char* getData() const { return _data; }
+			/** @return The size of the mapped file content in bytes */
+			size_t getSize() const { return _size; }
+
+
+		private:
+			/** Mapped file content */
+			const char* _data = nullptr;
+			/** Size of the mapped content */
+			size_t _size = 0;
+
+			// Platform handles
+#ifdef _WIN32
+			HANDLE _file = INVALID_HANDLE_VALUE;
+			HANDLE _mapping = nullptr;
+#else
+			int _file = -1;
+#endif
+	};
+}
@@ -17,13 +17,27 @@ namespace wde::Config {
 	/** True if the windows is in fullscreen mode */
 	bool IS_FULLSCREEN = false;
 
+	/** True to simulate the scene without a window or a render device (command line option --headless) */
+	bool HEADLESS = false;
+	/** Simulation steps run as fast as possible before exiting in headless mode (0 to simulate in real time until killed, option --steps) */
+	int HEADLESS_STEPS_COUNT = 0;
+	/** Path to the scene JSON file loaded at start (empty to select it with a file dialog, option --scene) */
+	std::string SCENE_PATH = "";
+
 	/** Vulkan API version */
 	uint32_t VULKAN_VERSION = VK_API_VERSION_1_2;
 
+	/** Duration of a simulation step (in seconds), independent of the frame rate */
+	float SIMULATION_STEP_TIME = 1.0f / 60.0f;
+	/** Max simulation steps run in a single frame (the time of slower frames is dropped instead of being caught up) */
+	int SIMULATION_MAX_STEPS_PER_FRAME = 5;
+
 
 	// Scene config
-	/** Max objects in each chunks */
+	/** Max objects in the scene default objects buffer */
 	int MAX_CHUNK_OBJECTS_COUNT = 10000;
+	/** Initial objects capacity of the chunks and culling GPU buffers (doubled when a chunk grows past it) */
+	int CHUNK_OBJECTS_MIN_CAPACITY = 64;
 	/** Max objects in the gizmo scene */
 	int MAX_GIZMO_OBJECTS_COUNT = 10000;
 
@@ -35,4 +49,26 @@ namespace wde::Config {
 	int MAX_CHUNKS_COUNT = 10000;
 	/** Radius of the loaded chunks */
 	int CHUNK_LOADED_DISTANCE = 3;
+	/** Radius after which the loaded chunks are unloaded (greater than CHUNK_LOADED_DISTANCE to avoid reloading chunks on borders) */
+	int CHUNK_UNLOADED_DISTANCE = 4;
+	/** Max memory used by the unloaded chunks kept in cache (in bytes) */
+	std::size_t CHUNK_CACHE_MEMORY_BUDGET = 256 * 1024 * 1024;
+	/** Max chunks loaded at the same time by background threads */
+	int CHUNK_LOADING_THREADS_COUNT = 4;
+	/** Threads ticking the active chunks, including the main thread (0 : one per hardware thread) */
+	int CHUNK_TICK_THREADS_COUNT = 0;
+	/** Simulation steps between two ticks of the chunks at each ring distance from the camera chunk (the last one is used for the farther rings, {1} to tick every chunk every step) */
+	std::vector<int> CHUNK_TICK_INTERVALS = {1, 1, 2, 4, 8};
+	/** Max loaded chunks that can have their GPU resources created in a single frame */
+	int CHUNK_MAX_CREATED_PER_FRAME = 2;
+	/** Number of frames ahead of the camera movement used to prefetch chunks */
+	int CHUNK_PREFETCH_FRAMES = 30;
+	/** True if the chunks should also be exported to JSON files when saved (for hand editing) */
+	bool CHUNK_EXPORT_JSON = false;
+	/** True if the static game objects of the chunks that share a material are merged into baked clusters (when loaded and saved) */
+	bool CHUNK_STATIC_BAKING = true;
+	/** Size of the spatial clusters of the baked static geometry, so that the clusters can still be culled (in world units) */
+	int CHUNK_STATIC_CLUSTER_SIZE = 16;
+	/** Min static game objects sharing a material in a cluster to merge them */
+	int CHUNK_STATIC_CLUSTER_MIN_OBJECTS = 4;
 }
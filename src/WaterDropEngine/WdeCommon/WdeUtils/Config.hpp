@@ -37,16 +37,35 @@ namespace wde::Config {
 	extern int HEIGHT;
 	extern bool IS_FULLSCREEN;
 
+	extern bool HEADLESS;
+	extern int HEADLESS_STEPS_COUNT;
+	extern std::string SCENE_PATH;
+
 	extern uint32_t VULKAN_VERSION;
 
+	extern float SIMULATION_STEP_TIME;
+	extern int SIMULATION_MAX_STEPS_PER_FRAME;
+
 	// Scene data
 	extern int MAX_CHUNK_OBJECTS_COUNT;
+	extern int CHUNK_OBJECTS_MIN_CAPACITY;
 	extern int MAX_GIZMO_OBJECTS_COUNT;
 
 	// World config
 	extern int CHUNK_SIZE;
 	extern int MAX_CHUNKS_COUNT;
 	extern int CHUNK_LOADED_DISTANCE;
+	extern int CHUNK_UNLOADED_DISTANCE;
+	extern std::size_t CHUNK_CACHE_MEMORY_BUDGET;
+	extern int CHUNK_LOADING_THREADS_COUNT;
+	extern int CHUNK_TICK_THREADS_COUNT;
+	extern std::vector<int> CHUNK_TICK_INTERVALS;
+	extern int CHUNK_MAX_CREATED_PER_FRAME;
+	extern int CHUNK_PREFETCH_FRAMES;
+	extern bool CHUNK_EXPORT_JSON;
+	extern bool CHUNK_STATIC_BAKING;
+	extern int CHUNK_STATIC_CLUSTER_SIZE;
+	extern int CHUNK_STATIC_CLUSTER_MIN_OBJECTS;
 }
 #endif
 
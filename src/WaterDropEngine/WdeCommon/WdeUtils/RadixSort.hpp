@@ -0,0 +1,49 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <vector>
+
+namespace wde {
+	/**
+	 * Stable least significant digit radix sort of values by a 64-bit key (8 bits per pass).
+	 * Passes whose digit is the same for every value are skipped, so keys using few bits are sorted in few passes.
+	 * @param values Values to sort
+	 * @param scratch Temporary storage (resized to the values count, can be kept between sorts to avoid allocations)
+	 * @param getKey Function that returns the 64-bit key of a value
+	 */
+	template<typename T, typename KeyFunction>
+	void radixSort(std::vector<T>& values, std::vector<T>& scratch, KeyFunction getKey) {
+		if (values.size() < 2)
+			return;
+		scratch.resize(values.size());
+
+		// Histograms of every digit in a single pass
+		std::array<std::array<std::size_t, 256>, 8> counts {};
+		for (const auto& value : values) {
+			uint64_t key = getKey(value);
+			for (int digit = 0; digit < 8; digit++)
+				counts[digit][(key >> (digit * 8)) & 0xFF]++;
+		}
+
+		for (int digit = 0; digit < 8; digit++) {
+			// Skip digits shared by every value
+			auto& digitCounts = counts[digit];
+			if (digitCounts[(getKey(values.front()) >> (digit * 8)) & 0xFF] == values.size())
+				continue;
+
+			// Offsets of each digit value
+			std::size_t offset = 0;
+			for (auto& count : digitCounts) {
+				std::size_t c = count;
+				count = offset;
+				offset += c;
+			}
+
+			// Scatter
+			for (auto& value : values)
+				scratch[digitCounts[(getKey(value) >> (digit * 8)) & 0xFF]++] = std::move(value);
+			values.swap(scratch);
+		}
+	}
+}
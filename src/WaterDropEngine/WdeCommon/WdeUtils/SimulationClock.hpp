@@ -0,0 +1,61 @@
+#pragma once
+
+#include <chrono>
+#include <algorithm>
+
+#include "Config.hpp"
+
+namespace wde {
+	/**
+	 * Splits the elapsed time into fixed simulation steps (Config::SIMULATION_STEP_TIME).
+	 * The remaining time is used to interpolate the rendered state between the two last steps.
+	 */
+	class SimulationClock {
+		public:
+			/** Called once per frame, before running the simulation steps */
+			void update() {
+				WDE_PROFILE_FUNCTION();
+				auto now = std::chrono::steady_clock::now();
+				if (_started)
+					_accumulator += std::chrono::duration<double>(now - _lastTime).count();
+				_started = true;
+				_lastTime = now;
+
+				// Drop the time that cannot be caught up (avoids running more and more steps after a slow frame)
+				double maxTime = static_cast<double>(Config::SIMULATION_STEP_TIME) * std::max(1, Config::SIMULATION_MAX_STEPS_PER_FRAME);
+				if (_accumulator > maxTime) {
+					_droppedTime += _accumulator - maxTime;
+					_accumulator = maxTime;
+				}
+			}
+
+			/**
+			 * Consumes the time of a simulation step
+			 * @return True if a simulation step must be run
+			 */
+			bool step() {
+				if (_accumulator < Config::SIMULATION_STEP_TIME)
+					return false;
+				_accumulator -= Config::SIMULATION_STEP_TIME;
+				_stepIndex++;
+				return true;
+			}
+
+			/** @return The duration of a simulation step (in seconds) */
+			float getStepTime() const { return Config::SIMULATION_STEP_TIME; }
+			/** @return The number of simulation steps run since the start */
+			uint64_t getStepIndex() const { return _stepIndex; }
+			/** @return The position of the frame between the two last simulation steps (0 = last step, 1 = next step) */
+			float getAlpha() const { return std::clamp(static_cast<float>(_accumulator / Config::SIMULATION_STEP_TIME), 0.0f, 1.0f); }
+			/** @return The time that was not simulated because the frames were too slow (in seconds) */
+			double getDroppedTime() const { return _droppedTime; }
+
+
+		private:
+			bool _started = false;
+			uint64_t _stepIndex = 0;
+			double _accumulator = 0.0;
+			double _droppedTime = 0.0;
+			std::chrono::time_point<std::chrono::steady_clock> _lastTime {};
+	};
+}
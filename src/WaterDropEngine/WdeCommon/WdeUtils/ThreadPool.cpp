@@ -0,0 +1,92 @@
+#include "ThreadPool.hpp"
+
+namespace wde {
+	ThreadPool::ThreadPool(std::size_t threadsCount) {
+		for (std::size_t i = 1; i < threadsCount; i++)
+			_threads.emplace_back(&ThreadPool::run, this);
+	}
+
+	ThreadPool::~ThreadPool() {
+		{
+			std::lock_guard<std::mutex> lock(_mutex);
+			_stop = true;
+		}
+		_startCondition.notify_all();
+		for (auto& thread : _threads)
+			thread.join();
+	}
+
+
+	void ThreadPool::parallelFor(std::size_t count, const std::function<void(std::size_t)>& task) {
+		// Nothing to share
+		if (_threads.empty() || count <= 1) {
+			for (std::size_t i = 0; i < count; i++)
+				task(i);
+			return;
+		}
+
+		// Start the loop on the workers
+		{
+			std::lock_guard<std::mutex> lock(_mutex);
+			_task = &task;
+			_count = count;
+			_next = 0;
+			_runningWorkers = _threads.size();
+			_exception = nullptr;
+			_loopIndex++;
+		}
+		_startCondition.notify_all();
+
+		// Run iterations with the workers, then wait for them
+		runIterations();
+		std::exception_ptr exception;
+		{
+			std::unique_lock<std::mutex> lock(_mutex);
+			_doneCondition.wait(lock, [this]() { return _runningWorkers == 0; });
+			_task = nullptr;
+			exception = std::exchange(_exception, nullptr);
+		}
+		if (exception)
+			std::rethrow_exception(exception);
+	}
+
+
+	void ThreadPool::run() {
+		uint64_t loopIndex = 0;
+		while (true) {
+			// Wait for a new loop
+			{
+				std::unique_lock<std::mutex> lock(_mutex);
+				_startCondition.wait(lock, [this, loopIndex]() { return _stop || _loopIndex != loopIndex; });
+				if (_stop)
+					return;
+				loopIndex = _loopIndex;
+			}
+
+			// Run iterations
+			runIterations();
+			{
+				std::lock_guard<std::mutex> lock(_mutex);
+				_runningWorkers--;
+			}
+			_doneCondition.notify_one();
+		}
+	}
+
+	void ThreadPool::runIterations() {
+		while (true) {
+			std::size_t i = _next.fetch_add(1);
+			if (i >= _count)
+				return;
+
+			try {
+				(*_task)(i);
+			}
+			catch (...) {
+				std::lock_guard<std::mutex> lock(_mutex);
+				if (!_exception)
+					_exception = std::current_exception();
+			}
+		}
+	}
+}
@@ -0,0 +1,72 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "NonCopyable.hpp"
+
+namespace wde {
+	/**
+	 * Fixed set of worker threads that run the iterations of a loop together with the calling thread.
+	 * Iterations are taken one at a time, so that iterations of different costs are balanced between the threads.
+	 */
+	class ThreadPool : public NonCopyable {
+		public:
+			/**
+			 * Starts the worker threads
+			 * @param threadsCount Number of threads running the loops, including the calling thread (at least 1)
+			 */
+			explicit ThreadPool(std::size_t threadsCount);
+			/** Stops the worker threads */
+			~ThreadPool() override;
+
+			/**
+			 * Runs task(i) for each i in [0, count) on the worker threads and on the calling thread, and returns once every
+			 * iteration is done. The first exception thrown by an iteration is thrown again on the calling thread.
+			 * @param count Number of iterations
+			 * @param task Iteration function
+			 */
+			void parallelFor(std::size_t count, const std::function<void(std::size_t)>& task);
+
+			/** @return The number of threads running the loops, including the calling thread */
+			std::size_t getThreadsCount() const { return _threads.size() + 1; }
+
+
+		private:
+			/** Worker threads */
+			std::vector<std::thread> _threads {};
+			/** Protects the loop state */
+			std::mutex _mutex;
+			/** Notified when a loop starts or when the workers should stop */
+			std::condition_variable _startCondition;
+			/** Notified when the last worker finished its iterations */
+			std::condition_variable _doneCondition;
+
+			// Current loop
+			/** Iteration function of the current loop */
+			const std::function<void(std::size_t)>* _task = nullptr;
+			/** Number of iterations of the current loop */
+			std::size_t _count = 0;
+			/** Next iteration to run */
+			std::atomic<std::size_t> _next {0};
+			/** Number of workers still running iterations of the current loop */
+			std::size_t _runningWorkers = 0;
+			/** Incremented each time a loop starts */
+			uint64_t _loopIndex = 0;
+			/** First exception thrown by an iteration of the current loop */
+			std::exception_ptr _exception {};
+			/** True if the workers should stop */
+			bool _stop = false;
+
+			/** Worker threads loop */
+			void run();
+			/** Runs the remaining iterations of the current loop */
+			void runIterations();
+	};
+}
@@ -0,0 +1,74 @@
+#include "TransformBatch.hpp"
+#include "TransformBatchKernels.hpp"
+
+#include "../WdeLogger/Instrumentation.hpp"
+
+namespace wde {
+	void TransformBatch::clear() {
+		_positionX.clear(); _positionY.clear(); _positionZ.clear();
+		_rotationX.clear(); _rotationY.clear(); _rotationZ.clear();
+		_scaleX.clear(); _scaleY.clear(); _scaleZ.clear();
+	}
+
+	void TransformBatch::add(const glm::vec3& position, const glm::vec3& rotation, const glm::vec3& scale) {
+		_positionX.push_back(position.x); _positionY.push_back(position.y); _positionZ.push_back(position.z);
+		_rotationX.push_back(rotation.x); _rotationY.push_back(rotation.y); _rotationZ.push_back(rotation.z);
+		_scaleX.push_back(scale.x); _scaleY.push_back(scale.y); _scaleZ.push_back(scale.z);
+	}
+
+	void TransformBatch::compute(std::vector<glm::mat4>& matrices) const {
+		compute(matrices, getBestImplementation());
+	}
+
+	void TransformBatch::compute(std::vector<glm::mat4>& matrices, Implementation implementation) const {
+		WDE_PROFILE_FUNCTION();
+		matrices.resize(size());
+		if (empty())
+			return;
+
+		kernels::TRSArrays input {
+			_positionX.data(), _positionY.data(), _positionZ.data(),
+			_rotationX.data(), _rotationY.data(), _rotationZ.data(),
+			_scaleX.data(), _scaleY.data(), _scaleZ.data()
+		};
+		static_assert(sizeof(glm::mat4) == 16 * sizeof(float), "Matrices should be tightly packed.");
+		auto* output = reinterpret_cast<float*>(matrices.data());
+
+		if (!isSupported(implementation))
+			implementation = getBestImplementation();
+		switch (implementation) {
+			case Implementation::AVX2:
+				kernels::composeTRSAVX2(input, 0, size(), output);
+				break;
+			case Implementation::SSE4:
+				kernels::composeTRSSSE4(input, 0, size(), output);
+				break;
+			default:
+				kernels::composeTRSScalar(input, 0, size(), output);
+				break;
+		}
+	}
+
+
+	TransformBatch::Implementation TransformBatch::getBestImplementation() {
+		static const Implementation best = isSupported(Implementation::AVX2) ? Implementation::AVX2
+				: (isSupported(Implementation::SSE4) ? Implementation::SSE4 : Implementation::SCALAR);
+		return best;
+	}
+
+	const char* TransformBatch::getImplementationName(Implementation implementation) {
+		switch (implementation) {
+			case Implementation::AVX2: return "AVX2";
+			case Implementation::SSE4: return "SSE4.1";
+			default: return "Scalar";
+		}
+	}
+
+	bool TransformBatch::isSupported(Implementation implementation) {
+		switch (implementation) {
+			case Implementation::AVX2: return kernels::isAVX2Supported();
+			case Implementation::SSE4: return kernels::isSSE4Supported();
+			default: return true;
+		}
+	}
+}
@@ -0,0 +1,67 @@
+#pragma once
+
+#include <vector>
+#include <glm/glm.hpp>
+
+namespace wde {
+	/**
+	 * Batch of transforms stored as structure of arrays, whose Translation * Ry * Rx * Rz * scale matrices are computed
+	 * together using the widest SIMD kernel supported by the CPU (AVX2, SSE4.1, or scalar fallback).
+	 */
+	class TransformBatch {
+		public:
+			/** Kernels used to compute the matrices */
+			enum class Implementation {
+				SCALAR,
+				SSE4,
+				AVX2
+			};
+
+			// Core functions
+			/** Removes every transform of the batch */
+			void clear();
+			/**
+			 * Adds a transform to the batch
+			 * @param position
+			 * @param rotation Euler angles (in radians)
+			 * @param scale
+			 */
+			void add(const glm::vec3& position, const glm::vec3& rotation, const glm::vec3& scale);
+			/**
+			 * Computes the matrices of the batch transforms (in their adding order) using the best supported kernel
+			 * @param matrices Output matrices (resized to the batch size)
+			 */
+			void compute(std::vector<glm::mat4>& matrices) const;
+			/**
+			 * Computes the matrices of the batch transforms (in their adding order)
+			 * @param matrices Output matrices (resized to the batch size)
+			 * @param implementation Kernel to use (falls back to the best supported one if not supported)
+			 */
+			void compute(std::vector<glm::mat4>& matrices, Implementation implementation) const;
+
+
+			// Getters
+			std::size_t size() const { return _positionX.size(); }
+			bool empty() const { return _positionX.empty(); }
+			/** @return The widest kernel supported by the CPU (detected once) */
+			static Implementation getBestImplementation();
+			/** @return The name of a kernel */
+			static const char* getImplementationName(Implementation implementation);
+
+
+		private:
+			// Transforms components
+			std::vector<float> _positionX {};
+			std::vector<float> _positionY {};
+			std::vector<float> _positionZ {};
+			std::vector<float> _rotationX {};
+			std::vector<float> _rotationY {};
+			std::vector<float> _rotationZ {};
+			std::vector<float> _scaleX {};
+			std::vector<float> _scaleY {};
+			std::vector<float> _scaleZ {};
+
+			/** @return True if the CPU supports the given kernel */
+			static bool isSupported(Implementation implementation);
+	};
+}
@@ -0,0 +1,114 @@
+#include "TransformBatchKernels.hpp"
+
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64)
+#include <immintrin.h>
+
+namespace wde::kernels {
+	namespace {
+		/** Computes 8 sines and cosines at once (Cephes single precision approximation, accurate for |x| < 8192) */
+		inline void sinCos(__m256 x, __m256& sin, __m256& cos) {
+			const __m256 signMask = _mm256_castsi256_ps(_mm256_set1_epi32(static_cast<int>(0x80000000)));
+			__m256 signSin = _mm256_and_ps(x, signMask);
+			x = _mm256_andnot_ps(signMask, x);
+
+			// Octant of x (rounded to even)
+			__m256i j = _mm256_cvttps_epi32(_mm256_mul_ps(x, _mm256_set1_ps(1.27323954473516f)));
+			j = _mm256_and_si256(_mm256_add_epi32(j, _mm256_set1_epi32(1)), _mm256_set1_epi32(~1));
+			__m256 y = _mm256_cvtepi32_ps(j);
+
+			// Signs and polynomial selection
+			__m256 swapSignSin = _mm256_castsi256_ps(_mm256_slli_epi32(_mm256_and_si256(j, _mm256_set1_epi32(4)), 29));
+			__m256 polyMask = _mm256_castsi256_ps(_mm256_cmpeq_epi32(_mm256_and_si256(j, _mm256_set1_epi32(2)), _mm256_setzero_si256()));
+			__m256 signCos = _mm256_castsi256_ps(_mm256_slli_epi32(_mm256_andnot_si256(_mm256_sub_epi32(j, _mm256_set1_epi32(2)), _mm256_set1_epi32(4)), 29));
+			signSin = _mm256_xor_ps(signSin, swapSignSin);
+
+			// Range reduction
+			x = _mm256_fmadd_ps(y, _mm256_set1_ps(-0.78515625f), x);
+			x = _mm256_fmadd_ps(y, _mm256_set1_ps(-2.4187564849853515625e-4f), x);
+			x = _mm256_fmadd_ps(y, _mm256_set1_ps(-3.77489497744594108e-8f), x);
+			__m256 z = _mm256_mul_ps(x, x);
+
+			// Cosine polynomial
+			__m256 c = _mm256_set1_ps(2.443315711809948e-5f);
+			c = _mm256_fmadd_ps(c, z, _mm256_set1_ps(-1.388731625493765e-3f));
+			c = _mm256_fmadd_ps(c, z, _mm256_set1_ps(4.166664568298827e-2f));
+			c = _mm256_mul_ps(_mm256_mul_ps(c, z), z);
+			c = _mm256_fnmadd_ps(z, _mm256_set1_ps(0.5f), c);
+			c = _mm256_add_ps(c, _mm256_set1_ps(1.0f));
+
+			// Sine polynomial
+			__m256 s = _mm256_set1_ps(-1.9515295891e-4f);
+			s = _mm256_fmadd_ps(s, z, _mm256_set1_ps(8.3321608736e-3f));
+			s = _mm256_fmadd_ps(s, z, _mm256_set1_ps(-1.6666654611e-1f));
+			s = _mm256_fmadd_ps(_mm256_mul_ps(s, z), x, x);
+
+			// Select polynomials for each octant
+			sin = _mm256_xor_ps(_mm256_blendv_ps(c, s, polyMask), signSin);
+			cos = _mm256_xor_ps(_mm256_blendv_ps(s, c, polyMask), signCos);
+		}
+
+		/** Transposes 4 matrix columns of 8 transforms and stores them */
+		inline void storeColumn(__m256 a, __m256 b, __m256 c, __m256 d, float* matrices, std::size_t column) {
+			for (int half = 0; half < 2; half++) {
+				__m128 a4 = half == 0 ? _mm256_castps256_ps128(a) : _mm256_extractf128_ps(a, 1);
+				__m128 b4 = half == 0 ? _mm256_castps256_ps128(b) : _mm256_extractf128_ps(b, 1);
+				__m128 c4 = half == 0 ? _mm256_castps256_ps128(c) : _mm256_extractf128_ps(c, 1);
+				__m128 d4 = half == 0 ? _mm256_castps256_ps128(d) : _mm256_extractf128_ps(d, 1);
+				_MM_TRANSPOSE4_PS(a4, b4, c4, d4);
+				float* out = matrices + half * 4 * 16 + column * 4;
+				_mm_storeu_ps(out + 0 * 16, a4);
+				_mm_storeu_ps(out + 1 * 16, b4);
+				_mm_storeu_ps(out + 2 * 16, c4);
+				_mm_storeu_ps(out + 3 * 16, d4);
+			}
+		}
+	}
+
+	void composeTRSAVX2(const TRSArrays& input, std::size_t begin, std::size_t end, float* matrices) {
+		std::size_t i = begin;
+		for (; i + 8 <= end; i += 8) {
+			__m256 s1, c1, s2, c2, s3, c3;
+			sinCos(_mm256_loadu_ps(input.rotationY + i), s1, c1);
+			sinCos(_mm256_loadu_ps(input.rotationX + i), s2, c2);
+			sinCos(_mm256_loadu_ps(input.rotationZ + i), s3, c3);
+			__m256 sx = _mm256_loadu_ps(input.scaleX + i);
+			__m256 sy = _mm256_loadu_ps(input.scaleY + i);
+			__m256 sz = _mm256_loadu_ps(input.scaleZ + i);
+			__m256 zero = _mm256_setzero_ps();
+			__m256 s2s3 = _mm256_mul_ps(s2, s3);
+			__m256 c3s2 = _mm256_mul_ps(c3, s2);
+
+			float* out = matrices + i * 16;
+			storeColumn(
+				_mm256_mul_ps(sx, _mm256_fmadd_ps(c1, c3, _mm256_mul_ps(s1, s2s3))),
+				_mm256_mul_ps(sx, _mm256_mul_ps(c2, s3)),
+				_mm256_mul_ps(sx, _mm256_fmsub_ps(c1, s2s3, _mm256_mul_ps(c3, s1))),
+				zero, out, 0);
+			storeColumn(
+				_mm256_mul_ps(sy, _mm256_fmsub_ps(c3s2, s1, _mm256_mul_ps(c1, s3))),
+				_mm256_mul_ps(sy, _mm256_mul_ps(c2, c3)),
+				_mm256_mul_ps(sy, _mm256_fmadd_ps(c1, c3s2, _mm256_mul_ps(s1, s3))),
+				zero, out, 1);
+			storeColumn(
+				_mm256_mul_ps(sz, _mm256_mul_ps(c2, s1)),
+				_mm256_mul_ps(sz, _mm256_sub_ps(zero, s2)),
+				_mm256_mul_ps(sz, _mm256_mul_ps(c1, c2)),
+				zero, out, 2);
+			storeColumn(
+				_mm256_loadu_ps(input.positionX + i),
+				_mm256_loadu_ps(input.positionY + i),
+				_mm256_loadu_ps(input.positionZ + i),
+				_mm256_set1_ps(1.0f), out, 3);
+		}
+
+		// Remaining transforms
+		composeTRSScalar(input, i, end, matrices);
+	}
+}
+#else
+namespace wde::kernels {
+	void composeTRSAVX2(const TRSArrays& input, std::size_t begin, std::size_t end, float* matrices) {
+		composeTRSScalar(input, begin, end, matrices);
+	}
+}
+#endif
@@ -0,0 +1,35 @@
+#pragma once
+
+#include <cstddef>
+
+namespace wde::kernels {
+	/** Positions, Euler rotations and scales of a batch of transforms, stored as structure of arrays */
+	struct TRSArrays {
+		const float* positionX;
+		const float* positionY;
+		const float* positionZ;
+		const float* rotationX;
+		const float* rotationY;
+		const float* rotationZ;
+		const float* scaleX;
+		const float* scaleY;
+		const float* scaleZ;
+	};
+
+	/**
+	 * Write the matrices Translation * Ry * Rx * Rz * scale (column-major, 16 floats per matrix) of a range of transforms.
+	 * The SIMD kernels are compiled for their instruction set, and must only be called if the CPU supports it.
+	 * @param input Transforms of the batch
+	 * @param begin Index of the first transform to compute
+	 * @param end Index after the last transform to compute
+	 * @param matrices Output matrices of the whole batch
+	 */
+	void composeTRSScalar(const TRSArrays& input, std::size_t begin, std::size_t end, float* matrices);
+	void composeTRSSSE4(const TRSArrays& input, std::size_t begin, std::size_t end, float* matrices);
+	void composeTRSAVX2(const TRSArrays& input, std::size_t begin, std::size_t end, float* matrices);
+
+	/** @return True if the CPU supports the SSE4.1 kernel */
+	bool isSSE4Supported();
+	/** @return True if the CPU supports the AVX2 kernel (with FMA) */
+	bool isAVX2Supported();
+}
@@ -0,0 +1,107 @@
+#include "TransformBatchKernels.hpp"
+
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64)
+#include <immintrin.h>
+
+namespace wde::kernels {
+	namespace {
+		/** Computes 4 sines and cosines at once (Cephes single precision approximation, accurate for |x| < 8192) */
+		inline void sinCos(__m128 x, __m128& sin, __m128& cos) {
+			const __m128 signMask = _mm_castsi128_ps(_mm_set1_epi32(static_cast<int>(0x80000000)));
+			__m128 signSin = _mm_and_ps(x, signMask);
+			x = _mm_andnot_ps(signMask, x);
+
+			// Octant of x (rounded to even)
+			__m128i j = _mm_cvttps_epi32(_mm_mul_ps(x, _mm_set1_ps(1.27323954473516f)));
+			j = _mm_and_si128(_mm_add_epi32(j, _mm_set1_epi32(1)), _mm_set1_epi32(~1));
+			__m128 y = _mm_cvtepi32_ps(j);
+
+			// Signs and polynomial selection
+			__m128 swapSignSin = _mm_castsi128_ps(_mm_slli_epi32(_mm_and_si128(j, _mm_set1_epi32(4)), 29));
+			__m128 polyMask = _mm_castsi128_ps(_mm_cmpeq_epi32(_mm_and_si128(j, _mm_set1_epi32(2)), _mm_setzero_si128()));
+			__m128 signCos = _mm_castsi128_ps(_mm_slli_epi32(_mm_andnot_si128(_mm_sub_epi32(j, _mm_set1_epi32(2)), _mm_set1_epi32(4)), 29));
+			signSin = _mm_xor_ps(signSin, swapSignSin);
+
+			// Range reduction
+			x = _mm_add_ps(x, _mm_mul_ps(y, _mm_set1_ps(-0.78515625f)));
+			x = _mm_add_ps(x, _mm_mul_ps(y, _mm_set1_ps(-2.4187564849853515625e-4f)));
+			x = _mm_add_ps(x, _mm_mul_ps(y, _mm_set1_ps(-3.77489497744594108e-8f)));
+			__m128 z = _mm_mul_ps(x, x);
+
+			// Cosine polynomial
+			__m128 c = _mm_set1_ps(2.443315711809948e-5f);
+			c = _mm_add_ps(_mm_mul_ps(c, z), _mm_set1_ps(-1.388731625493765e-3f));
+			c = _mm_add_ps(_mm_mul_ps(c, z), _mm_set1_ps(4.166664568298827e-2f));
+			c = _mm_mul_ps(_mm_mul_ps(c, z), z);
+			c = _mm_sub_ps(c, _mm_mul_ps(z, _mm_set1_ps(0.5f)));
+			c = _mm_add_ps(c, _mm_set1_ps(1.0f));
+
+			// Sine polynomial
+			__m128 s = _mm_set1_ps(-1.9515295891e-4f);
+			s = _mm_add_ps(_mm_mul_ps(s, z), _mm_set1_ps(8.3321608736e-3f));
+			s = _mm_add_ps(_mm_mul_ps(s, z), _mm_set1_ps(-1.6666654611e-1f));
+			s = _mm_add_ps(_mm_mul_ps(_mm_mul_ps(s, z), x), x);
+
+			// Select polynomials for each octant
+			sin = _mm_xor_ps(_mm_blendv_ps(c, s, polyMask), signSin);
+			cos = _mm_xor_ps(_mm_blendv_ps(s, c, polyMask), signCos);
+		}
+
+		/** Transposes 4 matrix columns of 4 transforms and stores them */
+		inline void storeColumn(__m128 a, __m128 b, __m128 c, __m128 d, float* matrices, std::size_t column) {
+			_MM_TRANSPOSE4_PS(a, b, c, d);
+			_mm_storeu_ps(matrices + 0 * 16 + column * 4, a);
+			_mm_storeu_ps(matrices + 1 * 16 + column * 4, b);
+			_mm_storeu_ps(matrices + 2 * 16 + column * 4, c);
+			_mm_storeu_ps(matrices + 3 * 16 + column * 4, d);
+		}
+	}
+
+	void composeTRSSSE4(const TRSArrays& input, std::size_t begin, std::size_t end, float* matrices) {
+		std::size_t i = begin;
+		for (; i + 4 <= end; i += 4) {
+			__m128 s1, c1, s2, c2, s3, c3;
+			sinCos(_mm_loadu_ps(input.rotationY + i), s1, c1);
+			sinCos(_mm_loadu_ps(input.rotationX + i), s2, c2);
+			sinCos(_mm_loadu_ps(input.rotationZ + i), s3, c3);
+			__m128 sx = _mm_loadu_ps(input.scaleX + i);
+			__m128 sy = _mm_loadu_ps(input.scaleY + i);
+			__m128 sz = _mm_loadu_ps(input.scaleZ + i);
+			__m128 zero = _mm_setzero_ps();
+			__m128 s2s3 = _mm_mul_ps(s2, s3);
+			__m128 c3s2 = _mm_mul_ps(c3, s2);
+
+			float* out = matrices + i * 16;
+			storeColumn(
+				_mm_mul_ps(sx, _mm_add_ps(_mm_mul_ps(c1, c3), _mm_mul_ps(s1, s2s3))),
+				_mm_mul_ps(sx, _mm_mul_ps(c2, s3)),
+				_mm_mul_ps(sx, _mm_sub_ps(_mm_mul_ps(c1, s2s3), _mm_mul_ps(c3, s1))),
+				zero, out, 0);
+			storeColumn(
+				_mm_mul_ps(sy, _mm_sub_ps(_mm_mul_ps(c3s2, s1), _mm_mul_ps(c1, s3))),
+				_mm_mul_ps(sy, _mm_mul_ps(c2, c3)),
+				_mm_mul_ps(sy, _mm_add_ps(_mm_mul_ps(c1, c3s2), _mm_mul_ps(s1, s3))),
+				zero, out, 1);
+			storeColumn(
+				_mm_mul_ps(sz, _mm_mul_ps(c2, s1)),
+				_mm_mul_ps(sz, _mm_sub_ps(zero, s2)),
+				_mm_mul_ps(sz, _mm_mul_ps(c1, c2)),
+				zero, out, 2);
+			storeColumn(
+				_mm_loadu_ps(input.positionX + i),
+				_mm_loadu_ps(input.positionY + i),
+				_mm_loadu_ps(input.positionZ + i),
+				_mm_set1_ps(1.0f), out, 3);
+		}
+
+		// Remaining transforms
+		composeTRSScalar(input, i, end, matrices);
+	}
+}
+#else
+namespace wde::kernels {
+	void composeTRSSSE4(const TRSArrays& input, std::size_t begin, std::size_t end, float* matrices) {
+		composeTRSScalar(input, begin, end, matrices);
+	}
+}
+#endif
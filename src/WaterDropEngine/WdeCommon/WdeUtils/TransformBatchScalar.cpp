@@ -0,0 +1,53 @@
+#include "TransformBatchKernels.hpp"
+
+#include <cmath>
+
+namespace wde::kernels {
+	void composeTRSScalar(const TRSArrays& input, std::size_t begin, std::size_t end, float* matrices) {
+		for (std::size_t i = begin; i < end; i++) {
+			const float c3 = std::cos(input.rotationZ[i]);
+			const float s3 = std::sin(input.rotationZ[i]);
+			const float c2 = std::cos(input.rotationX[i]);
+			const float s2 = std::sin(input.rotationX[i]);
+			const float c1 = std::cos(input.rotationY[i]);
+			const float s1 = std::sin(input.rotationY[i]);
+			const float sx = input.scaleX[i];
+			const float sy = input.scaleY[i];
+			const float sz = input.scaleZ[i];
+
+			float* m = matrices + i * 16;
+			m[0] = sx * (c1 * c3 + s1 * s2 * s3);
+			m[1] = sx * (c2 * s3);
+			m[2] = sx * (c1 * s2 * s3 - c3 * s1);
+			m[3] = 0.0f;
+			m[4] = sy * (c3 * s1 * s2 - c1 * s3);
+			m[5] = sy * (c2 * c3);
+			m[6] = sy * (c1 * c3 * s2 + s1 * s3);
+			m[7] = 0.0f;
+			m[8] = sz * (c2 * s1);
+			m[9] = sz * (-s2);
+			m[10] = sz * (c1 * c2);
+			m[11] = 0.0f;
+			m[12] = input.positionX[i];
+			m[13] = input.positionY[i];
+			m[14] = input.positionZ[i];
+			m[15] = 1.0f;
+		}
+	}
+
+	bool isSSE4Supported() {
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+		return __builtin_cpu_supports("sse4.1");
+#else
+		return false;
+#endif
+	}
+
+	bool isAVX2Supported() {
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+		return __builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma");
+#else
+		return false;
+#endif
+	}
+}
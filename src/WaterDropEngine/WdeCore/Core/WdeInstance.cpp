@@ -1,6 +1,8 @@
 #include "WdeInstance.hpp"
 #include "../../WaterDropEngine.hpp"
 
+#include <charconv>
+
 namespace wde {
 	WdeInstance::WdeInstance() {
 		WDE_PROFILE_FUNCTION();
@@ -14,19 +16,54 @@ namespace wde {
 		WaterDropEngine::get().start(*this);
 	}
 
+	void WdeInstance::startInstance(int argc, char* argv[]) {
+		WDE_PROFILE_FUNCTION();
+		// Read the engine options
+		for (int i = 1; i < argc; i++) {
+			std::string option = argv[i];
+			if (option == "--headless")
+				Config::HEADLESS = true;
+			else if (option == "--scene" && i + 1 < argc)
+				Config::SCENE_PATH = argv[++i];
+			else if (option == "--steps" && i + 1 < argc) {
+				std::string_view value = argv[++i];
+				auto result = std::from_chars(value.data(), value.data() + value.size(), Config::HEADLESS_STEPS_COUNT);
+				if (result.ec != std::errc() || result.ptr != value.data() + value.size() || Config::HEADLESS_STEPS_COUNT < 0)
+					throw WdeException(LogChannel::CORE, "Invalid steps count \"" + std::string(value) + "\" (expected a positive integer).");
+			}
+			else
+				throw WdeException(LogChannel::CORE, "Unknown command line option \"" + option + "\".");
+		}
+		if (Config::HEADLESS && Config::SCENE_PATH.empty())
+			throw WdeException(LogChannel::CORE, "The headless mode requires a scene (--scene <scene.json>).");
+
+		// Start the engine
+		startInstance();
+	}
+
+	void WdeInstance::simulateInstance(float stepTime) {
+		WDE_PROFILE_FUNCTION();
+		if (_scene == nullptr)
+			throw WdeException(LogChannel::CORE, "The engine has no scene.");
+
+		// Simulation step for the scene
+		_scene->simulate(stepTime);
+	}
+
 	void WdeInstance::tickInstance() {
 		WDE_PROFILE_FUNCTION();
 		// Check if there is scene and pipeline
 		if (_scene == nullptr)
 			throw WdeException(LogChannel::CORE, "The engine has no scene.");
-		if (_pipeline == nullptr)
+		if (_pipeline == nullptr && !Config::HEADLESS)
 			throw WdeException(LogChannel::CORE, "The engine has no render pipeline.");
 
 		// Update the engine
 		update();
 
-		// Tick for the engine pipeline
-		_pipeline->tick();
+		// Tick for the engine pipeline (nothing is rendered in headless mode)
+		if (_pipeline != nullptr)
+			_pipeline->tick();
 
 		// Tick for the scene
 		_scene->tick();
@@ -41,8 +78,10 @@ namespace wde {
 		}
 
 		// Destroy render pipeline
-		_pipeline->cleanUp();
-		_pipeline.reset();
+		if (_pipeline != nullptr) {
+			_pipeline->cleanUp();
+			_pipeline.reset();
+		}
 
 		// Clean up instance
 		cleanUp();
@@ -54,6 +93,11 @@ namespace wde {
 
 	void WdeInstance::setRenderPipeline(std::shared_ptr<render::WdeRenderPipelineInstance> pipeline) {
 		WDE_PROFILE_FUNCTION();
+		// No render device to setup the pipeline in headless mode
+		if (Config::HEADLESS) {
+			logger::log(LogLevel::INFO, LogChannel::CORE) << "Ignoring the render pipeline in headless mode." << logger::endl;
+			return;
+		}
 		_pipeline = std::move(pipeline);
 		_pipeline->setup();
 	}
@@ -22,7 +22,18 @@ namespace wde {
 
 			/** Start the engine */
 			void startInstance();
-			/** Tick for the engine instance (called by WaterDropEngine) */
+			/**
+			 * Start the engine with the command line options (--headless, --scene <scene.json>, --steps <count>)
+			 * @param argc
+			 * @param argv
+			 */
+			void startInstance(int argc, char* argv[]);
+			/**
+			 * Runs a fixed simulation step of the scene, zero or more times per frame (called by WaterDropEngine)
+			 * @param stepTime Duration of the step (in seconds)
+			 */
+			void simulateInstance(float stepTime);
+			/** Tick for the engine instance, once per frame (called by WaterDropEngine) */
 			void tickInstance();
 			/** Clean up the engine instance (called by WaterDropEngine) */
 			void cleanUpInstance();
@@ -95,7 +95,11 @@ namespace wde::gui {
 			// Set loading chunks IDs
 			void *computeLoadD = _loadingChBuffer->map();
 			auto* data4 = (int*) computeLoadD;
-			auto loadChunks = scene->getLoadingChunks();
+			std::vector<glm::ivec2> loadChunks {};
+			for (auto& c : scene->getLoadingChunks())
+				loadChunks.push_back(c.first);
+			for (auto& c : scene->getStreamingChunks())
+				loadChunks.push_back(c.first);
 			int k = 0;
 			for (auto& c : loadChunks) {
 				data4[k++] = int(c.x);
@@ -117,7 +121,7 @@ namespace wde::gui {
 			// Set unloading chunks IDs
 			void *computeUnloadD = _unloadChBuffer->map();
 			auto* data3 = (int*) computeUnloadD;
-			auto unloadChunks = scene->getUnloadingChunks();
+			auto& unloadChunks = scene->getUnloadingChunks();
 			int j = 0;
 			for (auto& c : unloadChunks) {
 				data3[j++] = int(c.first.x);
@@ -163,9 +167,35 @@ namespace wde::gui {
 		{
 			// Render world partition infos
 			ImGui::Text("Chunk size : %i x %i.", Config::CHUNK_SIZE, Config::CHUNK_SIZE);
-			ImGui::Text("Loading chunk count : %llu.",scene->getLoadingChunks().size());
-			ImGui::Text("Active chunk count : %llu.", scene->getActiveChunks().size());
+			ImGui::Text("Loading chunk count : %llu.", scene->getLoadingChunks().size() + scene->getStreamingChunks().size());
+			ImGui::Text("Active chunk count : %llu (%llu outside of the grid).", scene->getActiveChunks().size(), scene->getActiveChunks().getOverflowCount());
 			ImGui::Text("Unloading chunk count : %llu.", scene->getUnloadingChunks().size());
+			auto hits = scene->getPrefetchHits();
+			auto misses = scene->getPrefetchMisses();
+			ImGui::Text("Prefetch hits : %llu, misses : %llu (%.1f%%).", hits, misses, hits + misses == 0 ? 100.0 : 100.0 * double(hits) / double(hits + misses));
+			auto cacheHits = scene->getChunkCacheHits();
+			auto cacheMisses = scene->getChunkCacheMisses();
+			ImGui::Text("Cached chunk count : %llu (%.2f / %.2f MB).", scene->getDormantChunks().size(),
+						double(scene->getDormantChunksMemorySize()) / (1024.0 * 1024.0), double(Config::CHUNK_CACHE_MEMORY_BUDGET) / (1024.0 * 1024.0));
+			ImGui::Text("Cache hits : %llu, misses : %llu (%.1f%%).", cacheHits, cacheMisses, cacheHits + cacheMisses == 0 ? 0.0 : 100.0 * double(cacheHits) / double(cacheHits + cacheMisses));
+			ImGui::Text("Queued chunk writes : %llu.", scene->getChunkSaver().getQueuedCount());
+			std::size_t buffersMemory = 0;
+			std::size_t buffersCount = 0;
+			std::size_t uploadedBytes = 0;
+			std::size_t bakedObjects = 0;
+			std::size_t bakedClusters = 0;
+			for (auto& c : scene->getActiveChunks()) {
+				buffersMemory += c.second->getBuffersMemorySize();
+				buffersCount += c.second->hasBuffers() ? 1 : 0;
+				uploadedBytes += c.second->getUploadedBytes();
+				bakedObjects += c.second->getStaticGeometry().getBakedObjectsCount();
+				bakedClusters += c.second->getStaticGeometry().getClusters().size();
+			}
+			ImGui::Text("Chunks GPU memory : %.2f MB (%llu / %llu chunks).", double(buffersMemory) / (1024.0 * 1024.0), buffersCount, scene->getActiveChunks().size());
+			ImGui::Text("Uploaded to GPU per frame : %.2f KB.", double(uploadedBytes) / 1024.0);
+			ImGui::Text("Ticked chunks : %llu / %llu.", scene->getTickedChunksCount(), scene->getActiveChunks().size());
+			ImGui::Text("Simulated chunks per step : %llu / %llu.", scene->getSimulatedChunksCount(), scene->getActiveChunks().size());
+			ImGui::Text("Baked static objects : %llu (%llu clusters).", bakedObjects, bakedClusters);
 
 			// Render image
 			ImGui::Dummy(ImVec2(8.0f, 0.0f));
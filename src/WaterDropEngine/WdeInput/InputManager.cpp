@@ -51,6 +51,9 @@ namespace wde::input {
 	}
 
 	bool InputManager::isKeyDown(const std::string &keyName) const {
+		// No window to read the keys from in headless mode
+		if (Config::HEADLESS)
+			return false;
 		return glfwGetKey(WaterDropEngine::get().getRender().getWindow().getWindow(), _userKeyMapping.at(keyName)) == GLFW_PRESS;
 	}
 }
@@ -17,12 +17,6 @@ namespace wde::resource {
 			_materialID = materialID++;
 			_renderStage = std::pair<int, int>(matData["data"]["renderStage"]["pass"].get<int>(), matData["data"]["renderStage"]["subpass"].get<int>());
 
-			// Get shaders absolute reference
-			std::vector<std::string> shadersLoc {};
-			auto scenePath = WaterDropEngine::get().getInstance().getScene()->getPath();
-			for (auto& s : matData["data"]["shaders"])
-				shadersLoc.push_back(scenePath + "data/shaders/" + s.get<std::string>());
-
 			// Get polygon mode
 			if (matData["data"]["polygonMode"] == "fill")
 				_polygonMode = VK_POLYGON_MODE_FILL;
@@ -30,8 +24,20 @@ namespace wde::resource {
 				_polygonMode = VK_POLYGON_MODE_LINE;
 			else if (matData["data"]["polygonMode"] == "point")
 				_polygonMode = VK_POLYGON_MODE_POINT;
+		}
+
+		// Only the material description is loaded in headless mode (no pipeline, descriptors or textures)
+		if (Config::HEADLESS)
+			return;
+
+		// Create pipeline
+		{
+			// Get shaders absolute reference
+			std::vector<std::string> shadersLoc {};
+			auto scenePath = WaterDropEngine::get().getInstance().getScene()->getPath();
+			for (auto& s : matData["data"]["shaders"])
+				shadersLoc.push_back(scenePath + "data/shaders/" + s.get<std::string>());
 
-			// Create pipeline
 			_pipeline = std::make_unique<render::PipelineGraphics>(
 					_renderStage,
 					shadersLoc, // Shaders
@@ -2,112 +2,97 @@
 #include "../../WaterDropEngine.hpp"
 
 namespace wde::resource {
-	Mesh::Mesh(const std::string &path) : Resource(path, ResourceType::MESH) {
-		WDE_PROFILE_FUNCTION();
-		auto matData = json::parse(WdeFileUtils::readFile(path));
-		if (matData["type"] != "mesh")
-			throw WdeException(LogChannel::RES, "Trying to load a mesh from a non-mesh description.");
-
-		// Data
-		std::vector<Vertex> vertices;
-		std::vector<uint32_t> indices;
-		_name = matData["name"];
+	std::shared_ptr<const MeshGeometry> MeshGeometrySource::get() {
+		std::lock_guard<std::mutex> lock(_mutex);
+		if (_geometry == nullptr)
+			_geometry = std::make_shared<const MeshGeometry>(load(_path, _recalculateNormals));
+		return _geometry;
+	}
 
-		// Load data
-		{
-			WDE_PROFILE_SCOPE("wde::resource::Mesh::Mesh::loadMesh");
-			std::string resPath = WaterDropEngine::get().getInstance().getScene()->getPath() + "data/meshes/" + matData["data"]["path"].get<std::string>();
-
-			// Load model
-			tinyobj::attrib_t attrib;
-			std::vector<tinyobj::shape_t> shapes;
-			std::vector<tinyobj::material_t> materials;
-			std::string warn, err;
-
-			tinyobj::LoadObj(&attrib, &shapes, &materials, &warn, &err, resPath.c_str());
-			if (!warn.empty())
-				logger::log(LogLevel::WARN, LogChannel::SCENE) << "Failed to load model. " + std::string(warn) + std::string(err) << logger::endl;
-			if (!err.empty())
-				throw WdeException(LogChannel::SCENE, "Failed to load model. " + std::string(warn) + std::string(err));
-
-			// Combine every face into a single model and delete vertices repetition
-			std::unordered_map<size_t, uint32_t> verticesIndexHash {};
-			std::hash<Vertex> hasher;
-
-			// Loop over shapes
-			_occlusionSphere.w = 0.0;
-			for (const auto& shape : shapes) {
-				size_t faceTriangleOffset = 0; // Offset of the current triangle in the shape
-
-				// Loop over faces in the shape
-				for (size_t faceIndex = 0; faceIndex < shape.mesh.num_face_vertices.size(); faceIndex++) {
-					int faceSize = 3; // Load triangles (3 vertices)
-
-					// Loop over vertices in the face
-					for (size_t vertexID = 0; vertexID < faceSize; vertexID++) {
-						// Access to vertex
-						tinyobj::index_t index = shape.mesh.indices[faceTriangleOffset + vertexID];
-
-						// Set occlusion box bounds
-						auto vLength = std::sqrt(
-								attrib.vertices[3 * index.vertex_index + 0] * attrib.vertices[3 * index.vertex_index + 0]
-								+ attrib.vertices[3 * index.vertex_index + 1] * attrib.vertices[3 * index.vertex_index + 1]
-								+ attrib.vertices[3 * index.vertex_index + 2] * attrib.vertices[3 * index.vertex_index + 2]);
-						if (vLength * 2.0 > _occlusionSphere.w)
-							_occlusionSphere.w = vLength * 2;
-
-						// Get vertex
-						Vertex v {
-							{
-								attrib.vertices[3 * index.vertex_index + 0],
-								attrib.vertices[3 * index.vertex_index + 1],
-								attrib.vertices[3 * index.vertex_index + 2]
-							},
-							{
-								attrib.normals[3 * index.normal_index + 0],
-								attrib.normals[3 * index.normal_index + 1],
-								attrib.normals[3 * index.normal_index + 2]
-							},
-							{
-								attrib.texcoords[2 * index.texcoord_index + 0],
-								attrib.texcoords[2 * index.texcoord_index + 1]
-							}
-						};
-						// v._color = v._normal; // Use normals as color
-						v.uv.y = 1.0f - v.uv.y; // Invert uvs (they work as inverted in Vulkan)
-
-						// Avoid vertices duplication
-						size_t hash = hasher(v);
-						if (!verticesIndexHash.contains(hash)) { // New vertex
-							uint32_t indexID = vertices.size();
-							vertices.push_back(v); // push vertices
-
-							verticesIndexHash[hash] = indexID;
-							indices.push_back(indexID); // push indices
+	MeshGeometry MeshGeometrySource::load(const std::string& path, bool recalculateNormals) {
+		WDE_PROFILE_FUNCTION();
+		MeshGeometry geometry {};
+
+		// Load model
+		tinyobj::attrib_t attrib;
+		std::vector<tinyobj::shape_t> shapes;
+		std::vector<tinyobj::material_t> materials;
+		std::string warn, err;
+
+		tinyobj::LoadObj(&attrib, &shapes, &materials, &warn, &err, path.c_str());
+		if (!warn.empty())
+			logger::log(LogLevel::WARN, LogChannel::SCENE) << "Failed to load model. " + std::string(warn) + std::string(err) << logger::endl;
+		if (!err.empty())
+			throw WdeException(LogChannel::SCENE, "Failed to load model. " + std::string(warn) + std::string(err));
+
+		// Combine every face into a single model and delete vertices repetition
+		std::unordered_map<size_t, uint32_t> verticesIndexHash {};
+		std::hash<Vertex> hasher;
+
+		// Loop over shapes
+		for (const auto& shape : shapes) {
+			size_t faceTriangleOffset = 0; // Offset of the current triangle in the shape
+
+			// Loop over faces in the shape
+			for (size_t faceIndex = 0; faceIndex < shape.mesh.num_face_vertices.size(); faceIndex++) {
+				int faceSize = 3; // Load triangles (3 vertices)
+
+				// Loop over vertices in the face
+				for (size_t vertexID = 0; vertexID < faceSize; vertexID++) {
+					// Access to vertex
+					tinyobj::index_t index = shape.mesh.indices[faceTriangleOffset + vertexID];
+
+					// Get vertex
+					Vertex v {
+						{
+							attrib.vertices[3 * index.vertex_index + 0],
+							attrib.vertices[3 * index.vertex_index + 1],
+							attrib.vertices[3 * index.vertex_index + 2]
+						},
+						{
+							attrib.normals[3 * index.normal_index + 0],
+							attrib.normals[3 * index.normal_index + 1],
+							attrib.normals[3 * index.normal_index + 2]
+						},
+						{
+							attrib.texcoords[2 * index.texcoord_index + 0],
+							attrib.texcoords[2 * index.texcoord_index + 1]
 						}
-						else // Vertex already exists
-							indices.push_back(verticesIndexHash.at(hash));
+					};
+					// v._color = v._normal; // Use normals as color
+					v.uv.y = 1.0f - v.uv.y; // Invert uvs (they work as inverted in Vulkan)
+
+					// Avoid vertices duplication
+					size_t hash = hasher(v);
+					if (!verticesIndexHash.contains(hash)) { // New vertex
+						uint32_t indexID = geometry.vertices.size();
+						geometry.vertices.push_back(v); // push vertices
+
+						verticesIndexHash[hash] = indexID;
+						geometry.indices.push_back(indexID); // push indices
 					}
-
-					faceTriangleOffset += faceSize;
+					else // Vertex already exists
+						geometry.indices.push_back(verticesIndexHash.at(hash));
 				}
+
+				faceTriangleOffset += faceSize;
 			}
 		}
 
 		// Recalculate normals
-		if (matData["data"]["recalculateNormals"].get<bool>()) {
-			WDE_PROFILE_SCOPE("wde::resource::Mesh::Mesh::recomputeNormals");
+		if (recalculateNormals) {
+			WDE_PROFILE_SCOPE("wde::resource::MeshGeometrySource::load::recomputeNormals");
 
 			// Reset vertices normals
-			for (auto& vertex : vertices)
+			for (auto& vertex : geometry.vertices)
 				vertex.normal = glm::vec3 {0.0f, 0.0f, 0.0f};
 
 			// For each triangle, add the triangle normal to the binding vertices
-			for (int i = 0; i < _indexCount; i += 3) {
+			for (std::size_t i = 0; i + 2 < geometry.indices.size(); i += 3) {
 				// Triangle A,B,C
-				Vertex& a = vertices[indices[i + 0]];
-				Vertex& b = vertices[indices[i + 1]];
-				Vertex& c = vertices[indices[i + 2]];
+				Vertex& a = geometry.vertices[geometry.indices[i + 0]];
+				Vertex& b = geometry.vertices[geometry.indices[i + 1]];
+				Vertex& c = geometry.vertices[geometry.indices[i + 2]];
 
 				// Vectors
 				glm::vec3 ab = b.position - a.position;
@@ -123,13 +108,74 @@ namespace wde::resource {
 			}
 
 			// Normalize each vertex
-			for (auto& vertex : vertices)
+			for (auto& vertex : geometry.vertices)
 				vertex.normal = glm::normalize(vertex.normal);
 		}
 
-		// Initialize mesh
+		return geometry;
+	}
+
+
+
+	Mesh::Mesh(const std::string &path) : Resource(path, ResourceType::MESH) {
+		WDE_PROFILE_FUNCTION();
+		auto matData = json::parse(WdeFileUtils::readFile(path));
+		if (matData["type"] != "mesh")
+			throw WdeException(LogChannel::RES, "Trying to load a mesh from a non-mesh description.");
+		_name = matData["name"];
+
+		// Load data
+		std::string resPath = WaterDropEngine::get().getInstance().getScene()->getPath() + "data/meshes/" + matData["data"]["path"].get<std::string>();
+		bool recalculateNormals = matData["data"]["recalculateNormals"].get<bool>();
+		MeshGeometry geometry = MeshGeometrySource::load(resPath, recalculateNormals);
+
+		// Set occlusion sphere bounds
+		_occlusionSphere.w = 0.0;
+		for (const auto& vertex : geometry.vertices)
+			_occlusionSphere.w = std::max(_occlusionSphere.w, glm::length(vertex.position) * 2.0f);
+
+		// Initialize mesh (the vertices are not uploaded in headless mode)
+		if (!geometry.indices.empty())
+			_indexCount = geometry.indices.size();
+		if (!Config::HEADLESS)
+			createBuffers(geometry.vertices, geometry.indices);
+		else
+			_vertexCount = geometry.vertices.size();
+
+		// The geometry is loaded again on the CPU if it is needed to bake static geometry
+		_geometrySource = std::make_shared<MeshGeometrySource>(resPath, recalculateNormals);
+	}
+
+	Mesh::Mesh(const std::string& name, const std::vector<Vertex>& vertices, const std::vector<uint32_t>& indices, glm::vec4 collisionSphere)
+			: Resource(name, ResourceType::MESH), _name(name), _occlusionSphere(collisionSphere) {
+		WDE_PROFILE_FUNCTION();
+		_indexCount = indices.size();
+		createBuffers(vertices, indices);
+	}
+
+	Mesh::~Mesh() {
+		_commandBuffer = nullptr;
+	}
+
+	void Mesh::drawGUI() {
+#ifdef WDE_GUI_ENABLED
+		WDE_PROFILE_FUNCTION();
+		ImGui::Text("Mesh data :");
+		ImGui::Text("  - Index count : %i", _indexCount);
+		ImGui::Text("  - Vertex count : %i", _vertexCount);
+		ImGui::Text("  - URL : %s", _path.c_str());
+		ImGui::Text("  - Reference Count : %i", _referenceCount);
+#endif
+	}
+
+
+
+
+	void Mesh::createBuffers(const std::vector<Vertex>& vertices, const std::vector<uint32_t>& indices) {
+		WDE_PROFILE_FUNCTION();
+
 		{
-			WDE_PROFILE_SCOPE("wde::resource::Mesh::Mesh::createVerticesBuffer");
+			WDE_PROFILE_SCOPE("wde::resource::Mesh::createBuffers::createVerticesBuffer");
 			// Assert that vertices count >= 3
 			_vertexCount = vertices.size();
 			if (vertices.size() < 3)
@@ -148,7 +194,7 @@ namespace wde::resource {
 			stagingBuffer.unmap();
 
 			// Create vertex buffer
-			_vertexBuffer = std::make_shared<render::Buffer>(
+			_vertexBuffer = std::make_unique<render::Buffer>(
 					bufferSize,
 					VK_BUFFER_USAGE_VERTEX_BUFFER_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT, // Use this buffer as a destination on the GPU
 					VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT); // Use most efficient memory possible
@@ -159,11 +205,7 @@ namespace wde::resource {
 
 		// Create index buffer
 		{
-			WDE_PROFILE_SCOPE("wde::resource::Mesh::Mesh::createIndicesBuffer");
-			// Set indices count
-			if (!indices.empty())
-				_indexCount = indices.size();
-
+			WDE_PROFILE_SCOPE("wde::resource::Mesh::createBuffers::createIndicesBuffer");
 			// Assert that indices count >= 3
 			if (_indexCount < 3)
 				return;
@@ -181,7 +223,7 @@ namespace wde::resource {
 			stagingBuffer.unmap();
 
 			// Create index buffer
-			_indexBuffer = std::make_shared<render::Buffer>(
+			_indexBuffer = std::make_unique<render::Buffer>(
 					bufferSize,
 					VK_BUFFER_USAGE_INDEX_BUFFER_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT, // Use this buffer as a destination on the GPU
 					VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT); // Use most efficient memory possible
@@ -191,24 +233,15 @@ namespace wde::resource {
 		}
 	}
 
-	Mesh::~Mesh() {
-		_commandBuffer = nullptr;
-	}
-
-	void Mesh::drawGUI() {
-#ifdef WDE_GUI_ENABLED
-		WDE_PROFILE_FUNCTION();
-		ImGui::Text("Mesh data :");
-		ImGui::Text("  - Index count : %i", _indexCount);
-		ImGui::Text("  - Vertex count : %i", _vertexCount);
-		ImGui::Text("  - URL : %s", _path.c_str());
-		ImGui::Text("  - Reference Count : %i", _referenceCount);
-#endif
+	std::vector<std::unique_ptr<render::Buffer>> Mesh::releaseBuffers() {
+		std::vector<std::unique_ptr<render::Buffer>> buffers {};
+		if (_vertexBuffer != nullptr)
+			buffers.push_back(std::move(_vertexBuffer));
+		if (_indexBuffer != nullptr)
+			buffers.push_back(std::move(_indexBuffer));
+		return buffers;
 	}
 
-
-
-
 	void Mesh::bind(render::CommandBuffer &commandBuffer)  {
 		WDE_PROFILE_FUNCTION();
 		_commandBuffer = &commandBuffer;
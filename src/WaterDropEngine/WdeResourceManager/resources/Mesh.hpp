@@ -12,6 +12,7 @@
 #include <vulkan/vulkan_core.h>
 #include <glm/gtc/matrix_transform.hpp>
 #include <tiny_obj_loader.h>
+#include <mutex>
 
 namespace wde::resource {
 	/**
@@ -64,12 +65,62 @@ namespace wde::resource {
 
 
 
+	/**
+	 * Vertices and indices of a mesh on the CPU
+	 */
+	struct MeshGeometry {
+		std::vector<Vertex> vertices {};
+		std::vector<uint32_t> indices {};
+	};
+
+
+	/**
+	 * Loads the geometry of a mesh file on the CPU when it is first needed (to bake static geometry), and keeps it for the next uses.
+	 * Can be used from any thread, and stays valid while it is referenced, even if its mesh is released.
+	 */
+	class MeshGeometrySource {
+		public:
+			/**
+			 * @param path Path to the OBJ model file
+			 * @param recalculateNormals True if the normals are computed from the triangles
+			 */
+			MeshGeometrySource(std::string path, bool recalculateNormals) : _path(std::move(path)), _recalculateNormals(recalculateNormals) {}
+
+			/** @return The geometry of the mesh file (loaded by the first call) */
+			std::shared_ptr<const MeshGeometry> get();
+			/**
+			 * Loads the geometry of an OBJ model file (faces are merged into a single model, without duplicated vertices)
+			 * @param path Path to the OBJ model file
+			 * @param recalculateNormals True if the normals are computed from the triangles
+			 * @return The loaded geometry
+			 */
+			static MeshGeometry load(const std::string& path, bool recalculateNormals);
+
+
+		private:
+			std::string _path;
+			bool _recalculateNormals;
+			/** Protects the loaded geometry */
+			std::mutex _mutex;
+			std::shared_ptr<const MeshGeometry> _geometry {};
+	};
+
+
+
 	/**
 	 * Describes a scene mesh
 	 */
 	class Mesh : public Resource {
 		public:
 			explicit Mesh(const std::string& path);
+			/**
+			 * Creates a mesh from its vertices (not loaded from a resource file)
+			 * @param name Name of the mesh
+			 * @param vertices
+			 * @param indices
+			 * @param collisionSphere Visual collision sphere of the mesh (center offset and radius)
+			 */
+			Mesh(const std::string& name, const std::vector<Vertex>& vertices, const std::vector<uint32_t>& indices, glm::vec4 collisionSphere);
 			~Mesh() override;
 			void drawGUI() override;
 
@@ -102,20 +153,32 @@ namespace wde::resource {
 
 			// Getters and setters
 			std::string getName() const { return _name; }
+			uint32_t getID() const { return _meshID; }
 			int getIndexCount() const { return static_cast<int>(_indexCount); }
 			void setIndexCount(uint32_t count) { _indexCount = count; }
 			glm::vec4 getCollisionSphere() const { return _occlusionSphere; }
+			/** @return The CPU geometry of a mesh loaded from a file (nullptr for the meshes created from their vertices) */
+			const std::shared_ptr<MeshGeometrySource>& getGeometrySource() const { return _geometrySource; }
+			/**
+			 * Releases the mesh GPU buffers (the mesh cannot be rendered anymore)
+			 * @return The released buffers, that must be kept alive until the frames using them are done
+			 */
+			std::vector<std::unique_ptr<render::Buffer>> releaseBuffers();
 
 
 		protected:
 			// Core
+			/** Mesh UUID */
+			uint32_t _meshID = createID();
 			std::string _name;
-			uint32_t _indexCount;
-			uint32_t _vertexCount;
+			uint32_t _indexCount = 0;
+			uint32_t _vertexCount = 0;
+			/** Mesh file geometry, only loaded on the CPU by the static geometry baking (the vertices are not kept after their upload) */
+			std::shared_ptr<MeshGeometrySource> _geometrySource {};
 
 			// Model buffers
-			std::shared_ptr<render::Buffer> _indexBuffer;
-			std::shared_ptr<render::Buffer> _vertexBuffer;
+			std::unique_ptr<render::Buffer> _indexBuffer;
+			std::unique_ptr<render::Buffer> _vertexBuffer;
 
 
 			// Utils
@@ -124,6 +187,18 @@ namespace wde::resource {
 			/** Sphere visual collision sphere */
 			glm::vec4 _occlusionSphere {0.0f, 0.0f, 0.0f, 0.0f};
 
+			/**
+			 * Creates the GPU vertex and index buffers of the mesh
+			 * @param vertices
+			 * @param indices
+			 */
+			void createBuffers(const std::vector<Vertex>& vertices, const std::vector<uint32_t>& indices);
+			/** @return A new mesh UUID */
+			static uint32_t createID() {
+				static uint32_t meshID = 0;
+				return meshID++;
+			}
+
 	};
 }
 
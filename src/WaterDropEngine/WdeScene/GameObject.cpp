@@ -1,6 +1,7 @@
 #include "GameObject.hpp"
 #include "modules/MeshRendererModule.hpp"
 #include "modules/CameraModule.hpp"
+#include "terrain/Chunk.hpp"
 #include "../WaterDropEngine.hpp"
 
 /**
@@ -21,8 +22,12 @@ namespace ImGui {
 }
 
 namespace wde::scene {
-	GameObject::GameObject(uint32_t id, std::string name, bool isStatic) : _id(id), name(std::move(name)), _isStatic(isStatic) {
+	GameObjectRegistry GameObject::_registry {};
+
+	GameObject::GameObject(std::string name, bool isStatic) : name(std::move(name)), _isStatic(isStatic) {
 		WDE_PROFILE_FUNCTION();
+		_handle = _registry.add(this);
+
 		// Add default transform module
 		transform = addModule<TransformModule>();
 	}
@@ -31,16 +36,46 @@ namespace wde::scene {
 		WDE_PROFILE_FUNCTION();
 		transform = nullptr;
 		_modules.clear();
+		_registry.remove(_handle);
+		_moduleSlots = {};
+		_modulesMask = 0;
 	}
 
-	void GameObject::tick() {
+	void GameObject::invalidateModules() {
+		if (chunk != nullptr)
+			chunk->invalidateComponents();
+	}
+
+	void GameObject::removeModule(Module* module) {
+		auto it = std::find_if(_modules.begin(), _modules.end(), [module](const auto& mod) { return mod.get() == module; });
+		if (it == _modules.end())
+			return;
+		auto typeID = static_cast<uint32_t>(module->getTypeID());
+		_modules.erase(it);
+		invalidateModules();
+
+		// Update the slot with the next module of the same type
+		if (_moduleSlots[typeID] != module)
+			return;
+		_moduleSlots[typeID] = nullptr;
+		_modulesMask &= ~(1u << typeID);
+		for (auto& mod : _modules) {
+			if (static_cast<uint32_t>(mod->getTypeID()) == typeID) {
+				_moduleSlots[typeID] = mod.get();
+				_modulesMask |= 1u << typeID;
+				break;
+			}
+		}
+	}
+
+	void GameObject::tick(float deltaTime) {
 		if (!active)
 			return;
 
 		WDE_PROFILE_FUNCTION();
 		// Tick for modules
 		for (auto& mod : _modules)
-			mod->tick();
+			mod->tick(deltaTime);
 	}
 
 	void GameObject::drawGUI() {
@@ -49,9 +84,9 @@ namespace wde::scene {
 
 		// Type of the object
 		std::string typeName;
-		if (getModule<MeshRendererModule>())
+		if (hasModule<MeshRendererModule>())
 			typeName = "Mesh Entity";
-		else if (getModule<CameraModule>())
+		else if (hasModule<CameraModule>())
 			typeName = "Camera";
 		else
 			typeName = "Entity";
@@ -61,14 +96,16 @@ namespace wde::scene {
 		auto textS = ImGui::CalcTextSize("     ");
 		{
 			ImGui::PushFont(ImGui::GetIO().Fonts->Fonts[1]);
-			ImGui::PushID(static_cast<int>(_id) + 2312951);
+			ImGui::PushID(static_cast<int>(getID()) + 2312951);
 			if (active)
 				ImGui::PushStyleColor(ImGuiCol_Text, gui::GUITheme::colorTextMinor);
 			else
 				ImGui::PushStyleColor(ImGuiCol_Text, gui::GUITheme::colorGrayMinor);
 
-			if (active && ImGui::Selectable(ICON_FA_EYE, false, 0, textS) || (!active && ImGui::Selectable(ICON_FA_EYE_SLASH, false, 0, textS)))
+			if (active && ImGui::Selectable(ICON_FA_EYE, false, 0, textS) || (!active && ImGui::Selectable(ICON_FA_EYE_SLASH, false, 0, textS))) {
 				active = !active;
+				_isDirty = true;
+			}
 			ImGui::SameLine();
 			ImGui::PopStyleColor();
 			ImGui::PopID();
@@ -96,7 +133,10 @@ namespace wde::scene {
 				ImGui::Separator();
 				if (ImGui::Button("Close"))
 					ImGui::CloseCurrentPopup();
-				name = nameLoc;
+				if (name != nameLoc) {
+					name = nameLoc;
+					_isDirty = true;
+				}
 
 				// Delete object
 				ImGui::SameLine();
@@ -137,8 +177,8 @@ namespace wde::scene {
 				// Icon
 				ImGui::PushFont(ImGui::GetIO().Fonts->Fonts[1]);
 				auto scene = WaterDropEngine::get().getInstance().getScene();
-				ImGui::PushID(static_cast<int>(_id) + 6496321);
-				if (scene->getActiveCamera() != nullptr && scene->getActiveCamera()->getID() == _id) { // Current selected camera
+				ImGui::PushID(static_cast<int>(getID()) + 6496321);
+				if (scene->getActiveCamera() != nullptr && scene->getActiveCamera() == this) { // Current selected camera
 					ImGui::PushStyleColor(ImGuiCol_Text, gui::GUITheme::colorTextMinor);
 					if (ImGui::Selectable(ICON_FA_CAMERA, false, 0, textS)) {}
 				}
@@ -152,7 +192,7 @@ namespace wde::scene {
 
 				// Label
 				ImGui::SameLine();
-				if (scene->getActiveCamera() != nullptr && scene->getActiveCamera()->getID() == _id)
+				if (scene->getActiveCamera() != nullptr && scene->getActiveCamera() == this)
 					ImGui::PushStyleColor(ImGuiCol_Text, gui::GUITheme::colorTextMinor);
 				else
 					ImGui::PushStyleColor(ImGuiCol_Text, gui::GUITheme::colorGrayMinor);
@@ -206,6 +246,7 @@ namespace wde::scene {
 							if (module->getName() == "Camera" && WaterDropEngine::get().getInstance().getScene()->getActiveCamera() == this)
 								WaterDropEngine::get().getInstance().getScene()->setActiveCamera(nullptr);
 							moduleRemoved = true;
+							_isDirty = true;
 							ModuleSerializer::removeModuleFromName(module->getName(), *this);
 						}
 						ImGui::EndPopup();
@@ -216,16 +257,21 @@ namespace wde::scene {
 					ImGui::PopFont();
 					ImGui::PopStyleColor();
 
-					// Render header content
+					// Render header content (modules are considered edited while one of their fields is active)
 					ImGui::PushFont(ImGui::GetIO().FontDefault);
-					if (!moduleRemoved)
+					if (!moduleRemoved) {
 						module->drawGUI();
+						if (ImGui::IsAnyItemActive())
+							_isDirty = true;
+					}
 					ImGui::PopFont();
 				}
 				else {
 					if (module->getName() != "Transform" && ImGui::BeginPopupContextItem()) {
-						if (ImGui::Button("Remove Module"))
+						if (ImGui::Button("Remove Module")) {
+							_isDirty = true;
 							ModuleSerializer::removeModuleFromName(module->getName(), *this);
+						}
 						ImGui::EndPopup();
 					}
 					lastOneOpen = false;
@@ -251,8 +297,10 @@ namespace wde::scene {
 
 				ImGui::SameLine();
 				ImGui::SetNextItemWidth(width * 0.3f);
-				if (ImGui::Button("Add Module"))
+				if (ImGui::Button("Add Module")) {
+					_isDirty = true;
 					ModuleSerializer::addModuleFromName(modules[item_current], "", *this);
+				}
 			}
 		}
 #endif
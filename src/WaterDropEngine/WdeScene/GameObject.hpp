@@ -1,15 +1,19 @@
 #pragma once
 
 #include <utility>
+#include <array>
 
 #include "../../wde.hpp"
 #include "../WdeCore/Structure/Observer.hpp"
+#include "GameObjectRegistry.hpp"
 #include "modules/TransformModule.hpp"
 #include "../WdeRender/commands/CommandBuffer.hpp"
 #include "../WdeRender/buffers/Buffer.hpp"
 #include "../WdeRender/descriptors/DescriptorBuilder.hpp"
 
 namespace wde::scene {
+	class Chunk;
+
 	/**
 	 * Handles a game object
 	 */
@@ -25,55 +29,76 @@ namespace wde::scene {
 
 			// Core functions
 			/**
-			 * Create a new game object with a transform module (default : 0, 0, 0)
-			 * @param id Unique GO ID
+			 * Create a new game object with a transform module (default : 0, 0, 0), registered in the scene game objects
 			 * @param name
 			 * @param isStatic
 			 */
-			GameObject(uint32_t id, std::string name, bool isStatic);
+			GameObject(std::string name, bool isStatic);
 			~GameObject() override;
-			void tick();
+			/**
+			 * Tick for the game object modules
+			 * @param deltaTime Time since the last tick (in seconds)
+			 */
+			void tick(float deltaTime);
 			void drawGUI();
 
 
 			// Getters and setters
-			uint32_t getID() const { return _id; }
+			/** @return The ID of the game object, unique among the existing game objects */
+			uint32_t getID() const { return _handle.index; }
+			/** @return The handle of the game object (still valid if the game object moves to another chunk) */
+			GameObjectHandle getHandle() const { return _handle; }
+			/** @return The game object of a handle (nullptr if it was destroyed) */
+			static GameObject* find(GameObjectHandle handle) { return _registry.get(handle); }
+			/** @return The number of existing game objects */
+			static std::size_t getCount() { return _registry.size(); }
 			void setSelected(bool selected) { _isSelected = selected; }
 			bool isSelected() const { return _isSelected; }
 			bool isStatic() const { return _isStatic; }
+			/** @return True if the game object data changed since the last call to setDirty(false) */
+			bool isDirty() const { return _isDirty; }
+			void setDirty(bool dirty) { _isDirty = dirty; }
 			std::vector<std::unique_ptr<Module>>& getModules() { return _modules; }
+			/** Rebuilds the packed modules lists of the chunk of the game object (call when its modules changed without being added or removed) */
+			void invalidateModules();
 
 
 			// Modules handlers
 			template<typename T, typename ...Args>
 			T* addModule(Args ...args) {
 				_modules.push_back(std::make_unique<T>(*this, args...));
-				return static_cast<T*>(_modules[_modules.size() - 1].get());
+				auto mod = static_cast<T*>(_modules[_modules.size() - 1].get());
+				if (_moduleSlots[static_cast<uint32_t>(T::TYPE_ID)] == nullptr) {
+					_moduleSlots[static_cast<uint32_t>(T::TYPE_ID)] = mod;
+					_modulesMask |= 1u << static_cast<uint32_t>(T::TYPE_ID);
+				}
+				invalidateModules();
+				return mod;
 			}
 
+			/** @return The module of type T of the game object (nullptr if none) */
 			template<typename T>
 			T* getModule() {
-			    // Iterate over every module
-				for (auto& mod : _modules)
-					if (dynamic_cast<T*>(mod.get()) != nullptr)
-						return static_cast<T*>(mod.get());
-				// Not found
-				return nullptr;
+				return static_cast<T*>(_moduleSlots[static_cast<uint32_t>(T::TYPE_ID)]);
+			}
+
+			/** @return True if the game object has a module of type T */
+			template<typename T>
+			bool hasModule() const {
+				return (_modulesMask & (1u << static_cast<uint32_t>(T::TYPE_ID))) != 0;
 			}
 
 			template<typename T>
 			void removeModule() {
-				// Iterate over every module
-				int index = 0;
-				for (auto& mod : _modules) {
-					if (dynamic_cast<T *>(mod.get()) != nullptr) {
-						_modules.erase(_modules.begin() + index);
-						return;
-					}
-					index++;
-				}
+				removeModule(getModule<T>());
 			}
 
+			/**
+			 * Remove a given module
+			 * @param module
+			 */
+			void removeModule(Module* module);
+
 
 			// Public GO data
 			/** True if the game object is active */
@@ -83,16 +108,32 @@ namespace wde::scene {
 			/** Transform module of the game object */
 			TransformModule* transform;
 
+			// Chunk lists indices (maintained by the chunk owning the game object)
+			/** Chunk owning the game object (nullptr if none), whose packed modules lists are rebuilt when its modules change */
+			Chunk* chunk = nullptr;
+			/** Index of the game object in its chunk game objects list */
+			uint32_t chunkIndex = 0;
+			/** Index of the game object in its chunk static or dynamic game objects list */
+			uint32_t chunkTypeIndex = 0;
+
 
 		private:
-			/** GO description data */
-			uint32_t _id;
+			/** GO handle in the registry */
+			GameObjectHandle _handle {};
 			/** GO Modules */
 			std::vector<std::unique_ptr<Module>> _modules;
+			/** First module of each type (index : module type ID) */
+			std::array<Module*, static_cast<std::size_t>(ModuleTypeID::COUNT)> _moduleSlots {};
+			/** Bit i is set if the game object has a module of type ID i */
+			uint32_t _modulesMask = 0;
 			/** True if the game object is static (cannot be changed) */
 			bool _isStatic;
 			/** If true, this object will record from the input engine if it has a player controller */
 			bool _isSelected = false;
+			/** True if the game object data changed (the chunk of the object must be saved) */
+			bool _isDirty = false;
+			/** Every existing game object */
+			static GameObjectRegistry _registry;
 	};
 }
 
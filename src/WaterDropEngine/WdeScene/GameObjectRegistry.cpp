@@ -0,0 +1,46 @@
+#include "GameObjectRegistry.hpp"
+#include "../../wde.hpp"
+
+namespace wde::scene {
+	GameObjectRegistry::~GameObjectRegistry() {
+		for (auto& page : _pages)
+			delete[] page.load();
+	}
+
+	GameObjectHandle GameObjectRegistry::add(GameObject* gameObject) {
+		std::lock_guard<std::mutex> lock(_mutex);
+		uint32_t index;
+		if (!_freeSlots.empty()) {
+			index = _freeSlots.back();
+			_freeSlots.pop_back();
+		}
+		else {
+			// Allocate a new page when the last one is full (the pages are published before the slots count)
+			index = _slotsCount.load(std::memory_order_relaxed);
+			if (index % PAGE_SIZE == 0) {
+				if (index / PAGE_SIZE >= MAX_PAGES)
+					throw WdeException(LogChannel::SCENE, "Too many game objects (maximum " + std::to_string(PAGE_SIZE * MAX_PAGES) + ").");
+				_pages[index / PAGE_SIZE].store(new Slot[PAGE_SIZE], std::memory_order_relaxed);
+			}
+			_slotsCount.store(index + 1, std::memory_order_release);
+		}
+
+		Slot& slot = _pages[index / PAGE_SIZE].load(std::memory_order_relaxed)[index % PAGE_SIZE];
+		slot.gameObject.store(gameObject, std::memory_order_release);
+		_count.fetch_add(1, std::memory_order_relaxed);
+		return {index, slot.generation.load(std::memory_order_relaxed)};
+	}
+
+	void GameObjectRegistry::remove(GameObjectHandle handle) {
+		std::lock_guard<std::mutex> lock(_mutex);
+		if (handle.index >= _slotsCount.load(std::memory_order_relaxed))
+			return;
+		Slot& slot = _pages[handle.index / PAGE_SIZE].load(std::memory_order_relaxed)[handle.index % PAGE_SIZE];
+		if (slot.generation.load(std::memory_order_relaxed) != handle.generation)
+			return;
+		slot.gameObject.store(nullptr, std::memory_order_relaxed);
+		slot.generation.store(handle.generation + 1, std::memory_order_release);
+		_freeSlots.push_back(handle.index);
+		_count.fetch_sub(1, std::memory_order_relaxed);
+	}
+}
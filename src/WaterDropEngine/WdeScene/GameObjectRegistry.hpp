@@ -0,0 +1,87 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include <vector>
+
+namespace wde::scene {
+	class GameObject;
+
+	/**
+	 * Reference to a game object that stays valid while the game object exists, whatever its chunk,
+	 * and that resolves to nullptr once it is destroyed
+	 */
+	struct GameObjectHandle {
+		/** Slot of the game object in the registry */
+		uint32_t index = UINT32_MAX;
+		/** Generation of the slot when the game object was registered */
+		uint32_t generation = 0;
+
+		/** @return True if the handle does not reference any game object */
+		bool isNull() const { return index == UINT32_MAX; }
+		bool operator==(const GameObjectHandle& other) const = default;
+	};
+
+	/**
+	 * Slot map of every existing game object of the scene, referenced by generational handles.
+	 * Game objects register themselves when created, possibly from the chunks loading threads, so add() and remove() are
+	 * guarded by a mutex. Lookups are lock-free : the slots are stored in pages that never move once allocated.
+	 */
+	class GameObjectRegistry {
+		public:
+			GameObjectRegistry() = default;
+			~GameObjectRegistry();
+
+			/**
+			 * Register a game object in a free slot
+			 * @param gameObject
+			 * @return The handle of the game object
+			 */
+			GameObjectHandle add(GameObject* gameObject);
+			/**
+			 * Release the slot of a game object (its handles resolve to nullptr afterwards)
+			 * @param handle
+			 */
+			void remove(GameObjectHandle handle);
+			/** @return The game object of the handle (nullptr if it was destroyed), without locking */
+			GameObject* get(GameObjectHandle handle) const {
+				if (handle.index >= _slotsCount.load(std::memory_order_acquire))
+					return nullptr;
+				const Slot& slot = _pages[handle.index / PAGE_SIZE].load(std::memory_order_relaxed)[handle.index % PAGE_SIZE];
+				if (slot.generation.load(std::memory_order_acquire) != handle.generation)
+					return nullptr;
+				GameObject* gameObject = slot.gameObject.load(std::memory_order_acquire);
+				// The slot could have been released and reused by another game object while it was read
+				if (slot.generation.load(std::memory_order_relaxed) != handle.generation)
+					return nullptr;
+				return gameObject;
+			}
+			/** @return The number of registered game objects */
+			std::size_t size() const { return _count.load(std::memory_order_relaxed); }
+
+
+		private:
+			struct Slot {
+				std::atomic<GameObject*> gameObject {nullptr};
+				/** Incremented each time the slot is released */
+				std::atomic<uint32_t> generation {0};
+			};
+			/** Number of slots of a page */
+			static constexpr uint32_t PAGE_SIZE = 4096;
+			/** Maximum number of pages (16M game objects) */
+			static constexpr uint32_t MAX_PAGES = 4096;
+
+			/** Registry slots pages (allocated when the previous pages are full, never moved) */
+			std::array<std::atomic<Slot*>, MAX_PAGES> _pages {};
+			/** Number of slots in use or released (published after their page) */
+			std::atomic<uint32_t> _slotsCount {0};
+			/** Number of registered game objects */
+			std::atomic<std::size_t> _count {0};
+			/** Released slots that can be reused */
+			std::vector<uint32_t> _freeSlots {};
+			/** Guards the registration and release of the slots (game objects are created by the chunks loading threads) */
+			std::mutex _mutex {};
+	};
+}
@@ -9,9 +9,9 @@ namespace wde::scene {
 		WDE_PROFILE_FUNCTION();
 		logger::log(LogLevel::DEBUG, LogChannel::SCENE) << "== Initializing Scene Engine ==" << logger::endl;
 
-		// Load scene
-		std::string path;
-		auto content = WdeFileUtils::readFileDialog("json", path);
+		// Load scene (given on the command line, or selected by the user)
+		std::string path = Config::SCENE_PATH;
+		auto content = path.empty() ? WdeFileUtils::readFileDialog("json", path) : WdeFileUtils::readFile(path);
 		if (path.empty())
 			return;
 		auto fileData = json::parse(content);
@@ -130,10 +130,19 @@ namespace wde::scene {
 		WDE_PROFILE_FUNCTION();
 		logger::log(LogLevel::DEBUG, LogChannel::SCENE) << "Saving scene data." << logger::endl;
 
-		// Save chunk data
+		// Queue the changed chunks to be saved
 		auto scene = WaterDropEngine::get().getInstance().getScene();
-		for (auto& c : scene->getActiveChunks())
-			c.second->save();
+		for (auto& c : scene->getActiveChunks()) {
+			if (c.second->isDirty()) {
+				c.second->save();
+				c.second->bakeStaticGeometry();
+			}
+		}
+		for (auto& c : scene->getDormantChunks()) {
+			if ((*c.second)->isDirty())
+				(*c.second)->save();
+		}
+		scene->saveChunksManifest();
 
 		// Scene main data
 		json sceneData;
@@ -3,11 +3,14 @@
 
 namespace wde::scene {
 	WdeSceneInstance::WdeSceneInstance() {
+		// Create chunks writer
+		_chunkSaver = std::make_unique<ChunkSaver>();
+
 		// Create panel
 		_worldPartitionPanel = std::make_unique<gui::WorldPartitionPanel>();
 
-		// Create default global set
-		{
+		// Create default global set (no render device in headless mode)
+		if (!Config::HEADLESS) {
 			// Buffers
 			_cameraData = std::make_unique<render::Buffer>(sizeof(Chunk::GPUCameraData), VK_BUFFER_USAGE_UNIFORM_BUFFER_BIT);
 			_objectsData = std::make_unique<render::Buffer>(sizeof(scene::GameObject::GPUGameObjectData) * Config::MAX_CHUNK_OBJECTS_COUNT,
@@ -21,12 +24,50 @@ namespace wde::scene {
 		}
 	}
 
+	void WdeSceneInstance::setPath(const std::string& path) {
+		_scenePath = path;
+		loadChunksManifest();
+	}
+
+	void WdeSceneInstance::simulate(float stepTime) {
+		WDE_PROFILE_FUNCTION();
+		// States stored before this step are interpolated until the next one
+		TransformModule::nextStep();
+		_stepIndex++;
+
+		// Update editor camera
+#ifdef WDE_ENGINE_MODE_DEBUG
+		if (_editorCamera != nullptr) {
+			_editorCamera->transform->storeState();
+			_editorCamera->tick(stepTime);
+		}
+#endif
+
+		// Main thread work, then chunks simulated in parallel (the outer chunks are simulated every few steps only). Only the
+		// chunks with thread safe modules are dispatched, so the workers are not woken for empty loops.
+		glm::ivec2 cc = getCurrentChunkID();
+		_simulatedChunks.clear();
+		_simulatedChunksCount = 0;
+		for (auto& ch : _activeChunks) {
+			auto interval = static_cast<uint64_t>(getTickInterval(ch.first, cc));
+			uint64_t phase = (static_cast<uint32_t>(ch.first.x) * 73856093u) ^ (static_cast<uint32_t>(ch.first.y) * 19349663u); // Spreads the chunks ticks over the steps
+			if (ch.second->preSimulate(stepTime, (_stepIndex + phase) % interval == 0)) {
+				_simulatedChunksCount++;
+				if (ch.second->hasThreadSafeModules())
+					_simulatedChunks.push_back(ch.second.get());
+			}
+		}
+		getTickThreadPool().parallelFor(_simulatedChunks.size(), [this](std::size_t i) {
+			_simulatedChunks[i]->simulate();
+		});
+	}
+
 	void WdeSceneInstance::tick() {
 		// Create editor camera
 #ifdef WDE_ENGINE_MODE_DEBUG
-		if (_isFirstTick) {
+		if (_isFirstTick && !Config::HEADLESS) {
 			_isFirstTick = false;
-			_editorCamera = std::make_unique<GameObject>(-1, "Editor Camera", false);
+			_editorCamera = std::make_unique<GameObject>("Editor Camera", false);
 			auto camModule = _editorCamera->addModule<scene::CameraModule>();
 			camModule->setAsActive();
 			camModule->setFarPlane(std::numeric_limits<float>::max());
@@ -37,6 +78,10 @@ namespace wde::scene {
 		}
 #endif
 
+		// Cached transforms are checked for changes once per frame, and interpolated between the two last simulation steps
+		// (nothing is rendered in headless mode, so the last step is used)
+		TransformModule::nextFrame(Config::HEADLESS ? 1.0f : WaterDropEngine::get().getClock().getAlpha());
+
 		// Load and unload chunks
 		manageChunks();
 
@@ -47,54 +92,74 @@ namespace wde::scene {
 		// Update camera current chunk
 		{
 			WDE_PROFILE_SCOPE("wde::scene::WdeSceneInstance::tick::updateCameraChunk()");
-			static glm::ivec2 lastCC = cc;
-			if (cam != nullptr && lastCC != cc && cam->name != "Editor Camera") {
-				for (auto& go : getChunkSync(lastCC)->getGameObjects()) {
-					if (go.get() == cam) {
-						getChunkSync(cc)->addGameObject(go);
-						getChunkSync(lastCC)->removeGameObject(cam);
-						break;
-					}
-				}
+			// Move the chunks grids with the camera
+			if (_activeChunks.getRadius() != Config::CHUNK_UNLOADED_DISTANCE) {
+				_activeChunks.resize(Config::CHUNK_UNLOADED_DISTANCE);
+				_removingChunks.resize(Config::CHUNK_UNLOADED_DISTANCE);
+			}
+			_activeChunks.setCenter(cc);
+			_removingChunks.setCenter(cc);
+
+			// Update camera velocity (teleportations are ignored)
+			if (cam != nullptr) {
+				glm::vec3 delta = cam->transform->position - _lastCameraPosition;
+				if (glm::length(delta) > static_cast<float>(Config::CHUNK_SIZE))
+					delta = glm::vec3 {0.0f};
+				_cameraVelocity = glm::mix(_cameraVelocity, delta, 0.2f);
+				_lastCameraPosition = cam->transform->position;
+
+				// View of the interpolated camera transform
+				if (auto camModule = cam->getModule<CameraModule>())
+					camModule->updateView();
 			}
-			lastCC = cc;
-
-			// Update editor camera
-#ifdef WDE_ENGINE_MODE_DEBUG
-			_editorCamera->tick();
-#endif
 		}
 
 
-		// Make sure nearest chunk from the camera are loaded
+		// Update the loaded area when the camera or its predicted position enter a new chunk
 		{
 			WDE_PROFILE_SCOPE("wde::scene::WdeSceneInstance::tick::loadNearestChunks()");
-			int dist = Config::CHUNK_LOADED_DISTANCE;
-			for (int i = -dist; i <= dist; i++) {
-				for (int j = -dist; j <= dist; j++) {
-					if (i*i + j*j <= dist*dist)
-						getChunkSync({cc.x + i, cc.y + j});
-				}
-			}
+			glm::ivec2 pc = getPredictedChunkID();
+			if (!_loadedArea.valid || _loadedArea.center != cc || _loadedArea.predictedCenter != pc
+				|| _loadedArea.loadedDistance != Config::CHUNK_LOADED_DISTANCE || _loadedArea.unloadedDistance != Config::CHUNK_UNLOADED_DISTANCE)
+				updateLoadedArea(cc, pc);
 		}
 
-		// Tick for chunks and check if empty ones
+		// Tick for chunks (chunks leaving the area are removed by updateLoadedArea())
 		{
 			WDE_PROFILE_SCOPE("wde::scene::WdeSceneInstance::tick::tickForChunks()");
-			int dist = Config::CHUNK_LOADED_DISTANCE;
-			auto it = _activeChunks.begin();
-			while(it != _activeChunks.end()) {
-				// Tick
-				it->second->tick();
-
-				// Remove not-near chunks
-				if ((it->first.x - cc.x)*(it->first.x - cc.x) + (it->first.y - cc.y)*(it->first.y - cc.y) > dist*dist)
-					removeChunk(it->first);
-
-				it++;
+			if (getActiveCamera() == nullptr && !_activeChunks.empty() && !Config::HEADLESS)
+				logger::log(LogLevel::WARN, LogChannel::SCENE) << "No camera in scene." << logger::endl;
+
+			// Main thread work, then chunks ticked in parallel, then their GPU buffers changes
+			// (only the chunks simulated since the last frame or changed are ticked)
+			_tickedChunks.clear();
+			for (auto& ch : _activeChunks) {
+				if (ch.second->preTick())
+					_tickedChunks.push_back(ch.second.get());
+			}
+			for (auto ch : _tickedChunks)
+				ch->updateParentedTransforms();
+			getTickThreadPool().parallelFor(_tickedChunks.size(), [this](std::size_t i) {
+				_tickedChunks[i]->tick();
+			});
+			for (auto ch : _tickedChunks)
+				ch->postTick();
+
+			// The camera moves every frame, so its matrices are uploaded to every chunk (including the chunks that were not ticked)
+			Chunk::GPUCameraData cameraData {};
+			GameObject* activeCamera = getActiveCamera();
+			auto camModule = activeCamera != nullptr ? activeCamera->getModule<CameraModule>() : nullptr;
+			if (camModule != nullptr) {
+				cameraData.proj = camModule->getProjection();
+				cameraData.view = camModule->getView();
+				for (auto& ch : _activeChunks)
+					ch.second->uploadCameraData(cameraData);
 			}
 		}
 
+		// Move the game objects that left their chunk
+		migrateGameObjects();
+
 
 		// Update keys
 		{
@@ -114,14 +179,30 @@ namespace wde::scene {
 		// Delete panel
 		_worldPartitionPanel.reset();
 
-		// Clear chunks list
+		// Wait for the frames using the chunks
+		if (!Config::HEADLESS)
+			WaterDropEngine::get().getRender().getInstance().waitForDevicesReady();
+
+		// Clear chunks list (waits for the loading threads)
+		_loadingChunks.clear();
+		_streamingChunks.clear();
 		_activeChunks.clear();
 		_removingChunks.clear();
+		_dormantChunksIndex.clear();
+		_dormantChunks.clear();
+		_dormantChunksMemorySize = 0;
+		_releasedChunksBuffers.clear();
+		_loadedArea = {};
+
+		// Write the saved chunks and the manifest updated by them
+		saveChunksManifest();
+		_chunkSaver->flush();
 
 		// Remove references
 		_selectedGameObjectChunkID = {0, 0};
-		_selectedGameObject = nullptr;
-		_activeCamera = nullptr;
+		_selectedGameObject = {};
+		_activeCamera = {};
+		_cameras.clear();
 	}
 
 	void WdeSceneInstance::drawGizmo(Gizmo &gizmo) {
@@ -206,22 +287,39 @@ namespace wde::scene {
 
 
 	// Chunks
-	Chunk* WdeSceneInstance::getChunk(glm::ivec2 chunkID) {
+	Chunk* WdeSceneInstance::getChunk(glm::ivec2 chunkID, float priority) {
 		// Chunk found
-		if (_activeChunks.contains(chunkID))
-			return _activeChunks.at(chunkID).get();
+		if (auto ch = _activeChunks.find(chunkID))
+			return ch->get();
 
 		// Remove from deletion list
-		if (_removingChunks.contains(chunkID)) {
-			auto ch = _removingChunks.at(chunkID);
-			_activeChunks.emplace(chunkID, ch);
+		if (auto removingCh = _removingChunks.find(chunkID)) {
+			auto ch = *removingCh;
 			_removingChunks.erase(chunkID);
+			activateChunk(chunkID, ch);
+			return ch.get();
+		}
+
+		// Revive from dormant chunks
+		if (auto ch = reviveDormantChunk(chunkID))
+			return ch.get();
+
+		// Empty chunk, create it without reading its file
+		if (!isChunkOccupied(chunkID)) {
+			auto ch = std::make_shared<Chunk>(this, chunkID, false);
+			ch->createResources();
+			activateChunk(chunkID, ch);
 			return ch.get();
 		}
 
-		// Not found, add to loading list
-		if (std::find(_loadingChunks.begin(), _loadingChunks.end(), chunkID) == _loadingChunks.end())
-			_loadingChunks.push_back(chunkID);
+		// Not found, add to loading list (keeping its highest priority)
+		if (!_streamingChunks.contains(chunkID)) {
+			auto it = _loadingChunks.find(chunkID);
+			if (it == _loadingChunks.end())
+				_loadingChunks.emplace(chunkID, priority);
+			else
+				it->second = std::min(it->second, priority);
+		}
 		return nullptr;
 	}
 
@@ -229,162 +327,406 @@ namespace wde::scene {
 		WDE_PROFILE_FUNCTION();
 
 		// Chunk found
-		if (_activeChunks.contains(chunkID))
-			return _activeChunks.at(chunkID).get();
+		if (auto ch = _activeChunks.find(chunkID))
+			return ch->get();
 
 		// Remove from deletion list
-		if (_removingChunks.contains(chunkID)) {
-			auto ch = _removingChunks.at(chunkID);
-			_activeChunks.emplace(chunkID, ch);
+		if (auto removingCh = _removingChunks.find(chunkID)) {
+			auto ch = *removingCh;
 			_removingChunks.erase(chunkID);
+			activateChunk(chunkID, ch);
 			return ch.get();
 		}
 
-		// Not found, load sync
-		auto ch = std::make_shared<Chunk>(this, chunkID);
-		_activeChunks.emplace(chunkID, ch);
+		// Revive from dormant chunks
+		if (auto ch = reviveDormantChunk(chunkID))
+			return ch.get();
+
+		// Chunk is being loaded, wait for its loading thread
+		std::shared_ptr<Chunk> ch;
+		if (_streamingChunks.contains(chunkID)) {
+			ch = _streamingChunks.at(chunkID).get();
+			_streamingChunks.erase(chunkID);
+		}
+		// Not found, load sync (empty chunks are created without reading their file)
+		else {
+			_loadingChunks.erase(chunkID);
+			if (isChunkOccupied(chunkID))
+				_chunkCacheMisses++;
+			ch = std::make_shared<Chunk>(this, chunkID, isChunkOccupied(chunkID));
+		}
+		ch->createResources();
+		activateChunk(chunkID, ch);
 		return ch.get();
 	}
 
+	bool WdeSceneInstance::isChunkInArea(glm::ivec2 chunkID, int distance) const {
+		return isChunkInDisc(chunkID, _loadedArea.center, distance) || isChunkInDisc(chunkID, _loadedArea.predictedCenter, distance);
+	}
+
+	void WdeSceneInstance::activateChunk(glm::ivec2 chunkID, const std::shared_ptr<Chunk>& chunk) {
+		_activeChunks.emplace(chunkID, chunk);
+
+		// Chunks outside of the area are not removed by the area updates, remove them now
+		if (_loadedArea.valid && !isChunkInArea(chunkID, _loadedArea.unloadedDistance))
+			removeChunk(chunkID);
+	}
+
 	void WdeSceneInstance::removeChunk(glm::ivec2 chunkID) {
-		if (_removingChunks.contains(chunkID) || !_activeChunks.contains(chunkID))
+		auto ch = _activeChunks.find(chunkID);
+		if (ch == nullptr || _removingChunks.contains(chunkID))
 			return;
-		_removingChunks.emplace(chunkID, _activeChunks.at(chunkID));
+		_removingChunks.emplace(chunkID, *ch);
 	}
 
+	void WdeSceneInstance::releaseBuffers(std::vector<std::unique_ptr<render::Buffer>> buffers) {
+		if (buffers.empty())
+			return;
+		int framesInFlight = WaterDropEngine::get().getRender().getInstance().getMaxFramesInFlight();
+		std::lock_guard<std::mutex> lock(_releasedChunksBuffersMutex);
+		_releasedChunksBuffers.emplace_back(framesInFlight + 1, std::move(buffers));
+	}
+
+	void WdeSceneInstance::setChunkOccupied(glm::ivec2 chunkID, bool occupied) {
+		if (occupied == isChunkOccupied(chunkID))
+			return;
 
+		if (occupied)
+			_occupiedChunks.insert(chunkID);
+		else
+			_occupiedChunks.erase(chunkID);
+		_chunksManifestDirty = true;
+	}
+
+	std::shared_ptr<Chunk> WdeSceneInstance::reviveDormantChunk(glm::ivec2 chunkID) {
+		auto it = _dormantChunksIndex.find(chunkID);
+		if (it == _dormantChunksIndex.end())
+			return nullptr;
+		WDE_PROFILE_FUNCTION();
+
+		// Remove from cache
+		auto ch = *it->second;
+		_dormantChunksMemorySize -= ch->getMemorySize();
+		_dormantChunks.erase(it->second);
+		_dormantChunksIndex.erase(it);
+		_chunkCacheHits++;
+
+		// Recreate resources
+		ch->createResources();
+		activateChunk(chunkID, ch);
+		return ch;
+	}
+
+
+
+	void WdeSceneInstance::loadChunksManifest() {
+		WDE_PROFILE_FUNCTION();
+		_occupiedChunks.clear();
+		_chunksManifestDirty = false;
+
+		// Load manifest
+		if (WdeFileUtils::fileExist(_scenePath + "chunks.json")) {
+			auto fileData = json::parse(WdeFileUtils::readFile(_scenePath + "chunks.json"));
+			if (fileData["type"] != "chunksManifest")
+				throw WdeException(LogChannel::SCENE, "Trying to load a non-chunks manifest JSON object.");
+			for (const auto& id : fileData["data"]["chunks"])
+				_occupiedChunks.emplace(id[0].get<int>(), id[1].get<int>());
+			return;
+		}
+
+		// No manifest, create it from the chunk files
+		logger::log(LogLevel::INFO, LogChannel::SCENE) << "Creating chunks manifest of scene '" << _scenePath << "'." << logger::endl;
+		if (std::filesystem::exists(_scenePath + "chunk/")) {
+			for (const auto& file : std::filesystem::directory_iterator(_scenePath + "chunk/")) {
+				auto ext = file.path().extension().string();
+				glm::ivec2 id {0, 0};
+				if ((ext == ".json" || ext == ChunkFile::EXTENSION) && std::sscanf(file.path().stem().string().c_str(), "chunk_%d-%d", &id.x, &id.y) == 2)
+					_occupiedChunks.insert(id);
+			}
+		}
+		_chunksManifestDirty = true;
+		saveChunksManifest();
+	}
+
+	void WdeSceneInstance::saveChunksManifest() {
+		if (!_chunksManifestDirty)
+			return;
+		WDE_PROFILE_FUNCTION();
+		_chunksManifestDirty = false;
+		std::vector<json> chunks {};
+		chunks.reserve(_occupiedChunks.size());
+		for (auto& id : _occupiedChunks)
+			chunks.push_back({id.x, id.y});
+
+		json manifestData;
+		manifestData["type"] = "chunksManifest";
+		manifestData["data"]["chunks"] = chunks;
+		_chunkSaver->write(_scenePath + "chunks.json", to_string(manifestData));
+	}
+
+	void WdeSceneInstance::updateLoadedArea(glm::ivec2 center, glm::ivec2 predictedCenter) {
+		WDE_PROFILE_FUNCTION();
+		LoadedArea oldArea = _loadedArea;
+		_loadedArea = {true, center, predictedCenter, Config::CHUNK_LOADED_DISTANCE, Config::CHUNK_UNLOADED_DISTANCE};
+
+		// Calls a function for each chunk in the discs around the area centers
+		auto forEachAreaChunk = [](const LoadedArea& area, int distance, const auto& function) {
+			for (int k = 0; k < (area.predictedCenter == area.center ? 1 : 2); k++) {
+				glm::ivec2 c = k == 0 ? area.center : area.predictedCenter;
+				for (int i = -distance; i <= distance; i++) {
+					for (int j = -distance; j <= distance; j++) {
+						glm::ivec2 id {c.x + i, c.y + j};
+						if (i*i + j*j > distance*distance || (k == 1 && isChunkInDisc(id, area.center, distance)))
+							continue;
+						function(id);
+					}
+				}
+			}
+		};
+		auto isInArea = [](const LoadedArea& area, glm::ivec2 id, int distance) {
+			return area.valid && (isChunkInDisc(id, area.center, distance) || isChunkInDisc(id, area.predictedCenter, distance));
+		};
+
+		// Chunks close to the camera or to its predicted path are loaded first
+		float chunkSize = static_cast<float>(Config::CHUNK_SIZE);
+		glm::vec2 camPos {0.0f};
+		glm::vec2 predPos {0.0f};
+		if (auto cam = getActiveCamera()) {
+			camPos = glm::vec2 {cam->transform->position.x, cam->transform->position.z} / chunkSize;
+			predPos = camPos + glm::vec2 {_cameraVelocity.x, _cameraVelocity.z} * static_cast<float>(Config::CHUNK_PREFETCH_FRAMES) / chunkSize;
+		}
+		auto getPriority = [&camPos, &predPos](glm::ivec2 id) {
+			return std::min(glm::distance(glm::vec2(id), camPos), glm::distance(glm::vec2(id), predPos));
+		};
+
+		// Cancel the queued chunks that left the loaded area, and update the priority of the others
+		auto it = _loadingChunks.begin();
+		while (it != _loadingChunks.end()) {
+			if (!isInArea(_loadedArea, it->first, _loadedArea.loadedDistance))
+				it = _loadingChunks.erase(it);
+			else {
+				it->second = getPriority(it->first);
+				it++;
+			}
+		}
+
+		// Request the chunks entering the loaded area
+		forEachAreaChunk(_loadedArea, _loadedArea.loadedDistance, [&](glm::ivec2 id) {
+			if (!isInArea(oldArea, id, oldArea.loadedDistance))
+				getChunk(id, getPriority(id));
+		});
+
+		// Count chunks entering the camera loaded area that are available without waiting for their file
+		if (oldArea.valid && oldArea.center != center) {
+			int dist = _loadedArea.loadedDistance;
+			for (int i = -dist; i <= dist; i++) {
+				for (int j = -dist; j <= dist; j++) {
+					glm::ivec2 id {center.x + i, center.y + j};
+					if (i*i + j*j > dist*dist || isChunkInDisc(id, oldArea.center, oldArea.loadedDistance))
+						continue;
+					if (_activeChunks.contains(id))
+						_prefetchHits++;
+					else
+						_prefetchMisses++;
+				}
+			}
+		}
+
+		// Remove the chunks that left the unloaded area
+		if (!oldArea.valid) {
+			for (auto& ch : _activeChunks)
+				if (!isChunkInArea(ch.first, _loadedArea.unloadedDistance))
+					removeChunk(ch.first);
+		}
+		else {
+			forEachAreaChunk(oldArea, oldArea.unloadedDistance, [&](glm::ivec2 id) {
+				if (!isChunkInArea(id, _loadedArea.unloadedDistance))
+					removeChunk(id);
+			});
+		}
+	}
 
 	void WdeSceneInstance::manageChunks() {
+		// Create the chunks loaded by the background threads
 		{
-			WDE_PROFILE_SCOPE("wde::scene::WdeSceneInstance::tick::loadChunks()");
-			while (!_loadingChunks.empty()) {
-				glm::vec2 id = _loadingChunks.back();
-				if (_activeChunks.contains(id)) { // Already loaded
-					_loadingChunks.pop_back();
+			WDE_PROFILE_SCOPE("wde::scene::WdeSceneInstance::tick::createLoadedChunks()");
+			int createdCount = 0;
+			auto it = _streamingChunks.begin();
+			while (it != _streamingChunks.end() && createdCount < Config::CHUNK_MAX_CREATED_PER_FRAME) {
+				// Still loading
+				if (it->second.wait_for(std::chrono::seconds(0)) != std::future_status::ready) {
+					it++;
 					continue;
 				}
-				if (_removingChunks.contains(id)) // Should be removed but also created => should be created
-					_removingChunks.erase(id);
 
-				auto ch = std::make_shared<Chunk>(this, id);
-				_activeChunks.emplace(id, ch);
-				_loadingChunks.pop_back();
+				// Chunk left the unloaded area while loading, drop it
+				auto id = it->first;
+				auto ch = it->second.get();
+				it = _streamingChunks.erase(it);
+				if (!isChunkInArea(id, Config::CHUNK_UNLOADED_DISTANCE))
+					continue;
+
+				// Create chunk resources (GPU buffers and modules)
+				ch->createResources();
+				activateChunk(id, ch);
+				createdCount++;
 			}
 		}
 
-		// Remove chunks that need to be removed
+		// Start loading the queued chunks with the highest priority on background threads
 		{
-			WDE_PROFILE_SCOPE("wde::scene::WdeSceneInstance::tick::removeChunks()");
-			auto itr = _removingChunks.begin();
-			while(itr != _removingChunks.end()) {
-				auto id = itr->first;
-				// Chunk is loading
-				if (std::find(_loadingChunks.begin(), _loadingChunks.end(), id) != _loadingChunks.end()) {
-					itr++;
-					continue;
+			WDE_PROFILE_SCOPE("wde::scene::WdeSceneInstance::tick::loadChunks()");
+			if (static_cast<int>(_streamingChunks.size()) < Config::CHUNK_LOADING_THREADS_COUNT) {
+				// Order queued chunks by priority
+				auto compare = [](const std::pair<glm::ivec2, float>& a, const std::pair<glm::ivec2, float>& b) { return a.second > b.second; };
+				std::priority_queue<std::pair<glm::ivec2, float>, std::vector<std::pair<glm::ivec2, float>>, decltype(compare)> queue {compare};
+				for (auto& ch : _loadingChunks)
+					queue.push(ch);
+
+				while (!queue.empty() && static_cast<int>(_streamingChunks.size()) < Config::CHUNK_LOADING_THREADS_COUNT) {
+					glm::ivec2 id = queue.top().first;
+					queue.pop();
+					_loadingChunks.erase(id);
+					if (_activeChunks.contains(id) || _streamingChunks.contains(id)) // Already loaded
+						continue;
+					_chunkCacheMisses++;
+
+					_streamingChunks.emplace(id, std::async(std::launch::async, [this, id]() {
+						return std::make_shared<Chunk>(this, id);
+					}));
 				}
+			}
+		}
+
+		// Destroy the released buffers that are not used by any frame in flight anymore
+		{
+			WDE_PROFILE_SCOPE("wde::scene::WdeSceneInstance::tick::destroyReleasedBuffers()");
+			for (auto& buffers : _releasedChunksBuffers)
+				buffers.first--;
+			while (!_releasedChunksBuffers.empty() && _releasedChunksBuffers.front().first <= 0)
+				_releasedChunksBuffers.pop_front();
+		}
+
+		// Release chunks that need to be removed and keep them as dormant chunks
+		{
+			WDE_PROFILE_SCOPE("wde::scene::WdeSceneInstance::tick::removeChunks()");
+			for (auto& ch : _removingChunks) {
+				_activeChunks.erase(ch.first);
+				releaseBuffers(ch.second->releaseResources());
 
-				// Remove from active chunks
-				if (_activeChunks.contains(id))
-					_activeChunks.erase(id);
-				itr++;
+				// Empty chunks are cheaper to create again than to keep
+				if (ch.second->getGameObjects().empty() && !ch.second->isDirty())
+					continue;
+				_dormantChunks.push_front(ch.second);
+				_dormantChunksIndex[ch.first] = _dormantChunks.begin();
+				_dormantChunksMemorySize += ch.second->getMemorySize();
 			}
 			_removingChunks.clear();
 		}
-	}
 
+		// Destroy (and save if changed) the least recently used dormant chunks over the memory budget
+		{
+			WDE_PROFILE_SCOPE("wde::scene::WdeSceneInstance::tick::evictDormantChunks()");
+			while (!_dormantChunks.empty() && _dormantChunksMemorySize > Config::CHUNK_CACHE_MEMORY_BUDGET) {
+				auto& ch = _dormantChunks.back();
+				_dormantChunksMemorySize -= ch->getMemorySize();
+				_dormantChunksIndex.erase(ch->getPosition());
+				_dormantChunks.pop_back();
+			}
+		}
+	}
 
 
 
-	void WdeSceneInstance::reassignGOToChunks() {
-		WDE_PROFILE_FUNCTION();
-		logger::log(LogLevel::DEBUG, LogChannel::SCENE) << "Reassigning game objects to nearest chunks." << logger::endl;
 
-		// Store each go pointer into a vector
-		std::vector<std::shared_ptr<GameObject>> _gameObjectsTmp {};
-		for (auto& c : _activeChunks) {
-			for (auto &go: c.second->getGameObjects())
-				_gameObjectsTmp.push_back(go);
-
-			// Clear game objects
-			c.second->clearGameObjects();
-		}
+	ThreadPool& WdeSceneInstance::getTickThreadPool() {
+		auto threadsCount = static_cast<std::size_t>(Config::CHUNK_TICK_THREADS_COUNT > 0
+				? Config::CHUNK_TICK_THREADS_COUNT : std::max(1u, std::thread::hardware_concurrency()));
+		if (_tickThreadPool == nullptr || _tickThreadPool->getThreadsCount() != threadsCount)
+			_tickThreadPool = std::make_unique<ThreadPool>(threadsCount);
+		return *_tickThreadPool;
+	}
 
-		// Reassign game objects
-		double chunkSize = Config::CHUNK_SIZE;
-		for (auto& go : _gameObjectsTmp) {
-			// GO chunk position
-			glm::ivec2 chunkCoord {
-				std::floor(go->transform->position.x / chunkSize + 0.5),
-				std::floor(go->transform->position.z / chunkSize + 0.5)
-			};
+	int WdeSceneInstance::getTickInterval(glm::ivec2 chunkID, glm::ivec2 center) {
+		if (Config::CHUNK_TICK_INTERVALS.empty())
+			return 1;
+		glm::vec2 d {chunkID - center};
+		auto ring = static_cast<std::size_t>(glm::length(d));
+		return std::max(1, Config::CHUNK_TICK_INTERVALS[std::min(ring, Config::CHUNK_TICK_INTERVALS.size() - 1)]);
+	}
 
-			// Assign
-			getChunkSync(chunkCoord)->addGameObject(go);
+	GameObject* WdeSceneInstance::getFirstGameCamera() {
+		// Cameras are looked up by handle, and destroyed ones are forgotten
+		for (auto it = _cameras.begin(); it != _cameras.end();) {
+			GameObject* cam = GameObject::find(*it);
+			if (cam == nullptr)
+				it = _cameras.erase(it);
+			else if (cam != _editorCamera.get() && cam->getModule<CameraModule>() != nullptr)
+				return cam;
+			else
+				it++;
 		}
+		return nullptr;
 	}
 
-	void WdeSceneInstance::reorderGO() {
+	void WdeSceneInstance::migrateGameObjects() {
 		WDE_PROFILE_FUNCTION();
-		logger::log(LogLevel::DEBUG, LogChannel::SCENE) << "Reordering game objects." << logger::endl;
 
-		// For each chunks
+		// Gather the leaving game objects first (moving them can activate chunks)
+		_migratingGameObjects.clear();
 		for (auto& c : _activeChunks) {
-			// Copy game objects
-			auto& activeGO = c.second->getGameObjects();
-			std::unordered_map<resource::Material*, std::unordered_map<resource::Mesh*, std::vector<std::shared_ptr<GameObject>>>> res {};
-			std::vector<std::shared_ptr<GameObject>> otherObjects {};
-
-			// Order by materials and meshes
-			for (auto& go : activeGO) {
-				// Check if this game object will be rendered
-				auto matMod = go->getModule<MeshRendererModule>();
-				if (matMod == nullptr || matMod->getMaterial() == nullptr || matMod->getMesh() == nullptr) {
-					otherObjects.push_back(go);
-					continue;
-				}
+			for (GameObject* go : c.second->getLeavingGameObjects())
+				_migratingGameObjects.emplace_back(c.second.get(), go);
+			c.second->getLeavingGameObjects().clear();
+		}
 
-				// Create material if it doesn't exist
-				auto mat = matMod->getMaterial();
-				if (!res.contains(mat))
-					res.emplace(mat, std::unordered_map<resource::Mesh*, std::vector<std::shared_ptr<GameObject>>> {});
+		// Move them to the chunk containing their position. Game objects whose chunk is not active yet stay in their chunk
+		// while it loads in the background, and leave it again on one of its next ticks.
+		for (auto& [chunk, go] : _migratingGameObjects) {
+			if (auto target = getMigrationTarget(Chunk::getChunkID(go->transform->position)))
+				target->addGameObject(chunk->detachGameObject(go));
+		}
+	}
 
-				// Create mesh if it doesn't exit
-				auto mesh = matMod->getMesh();
-				if (!res.at(mat).contains(mesh))
-					res.at(mat).emplace(mesh, std::vector<std::shared_ptr<GameObject>> {});
+	Chunk* WdeSceneInstance::getMigrationTarget(glm::ivec2 chunkID) {
+		// Chunks that are not loaded are only requested inside the loaded area (the other loads would be dropped)
+		if (!_loadedArea.valid || isChunkInArea(chunkID, _loadedArea.loadedDistance))
+			return getChunk(chunkID, 0.0f);
+		if (auto ch = _activeChunks.find(chunkID))
+			return ch->get();
+		return nullptr;
+	}
 
-				// Add game object to material and mesh
-				res.at(mat).at(mesh).push_back(go);
-			}
+	void WdeSceneInstance::reassignGOToChunks() {
+		WDE_PROFILE_FUNCTION();
+		logger::log(LogLevel::DEBUG, LogChannel::SCENE) << "Reassigning game objects to nearest chunks." << logger::endl;
 
-			// Create new objects array ordered
-			std::vector<std::shared_ptr<GameObject>> newGO {};
-			std::vector<std::shared_ptr<GameObject>> newStaticGO {};
-			std::vector<std::shared_ptr<GameObject>> newDynamicGO {};
-			for (auto& matArr : res) {
-				for (auto& meshArr : matArr.second) {
-					for (auto& go : meshArr.second) {
-						newGO.push_back(go);
-						if (go->isStatic())
-							newStaticGO.push_back(go);
-						else
-							newDynamicGO.push_back(go);
-					}
-				}
-			}
-			for (auto& go : otherObjects) {
-				newGO.push_back(go);
-				if (go->isStatic())
-					newStaticGO.push_back(go);
-				else
-					newDynamicGO.push_back(go);
+		// Game objects go to the chunk of their hierarchy root, so that hierarchies are never split between chunks
+		auto getTargetChunk = [](GameObject* go) {
+			TransformModule* root = go->transform;
+			while (root->getParent() != nullptr)
+				root = root->getParent();
+			return Chunk::getChunkID(root->position);
+		};
+
+		// Gather the game objects outside of their chunk (moving them can activate chunks)
+		std::vector<std::pair<Chunk*, GameObject*>> gameObjects {};
+		for (auto& c : _activeChunks) {
+			for (auto &go: c.second->getGameObjects()) {
+				if (getTargetChunk(go.get()) != c.first)
+					gameObjects.emplace_back(c.second.get(), go.get());
 			}
+		}
 
-			// Rewriting dynamic and static game objects
-			c.second->getGameObjects() = newGO;
-			c.second->getDynamicGameObjects() = newDynamicGO;
-			c.second->getStaticGameObjects() = newStaticGO;
+		// Reassign game objects (the game objects whose chunk is not active yet stay in their chunk while it loads)
+		std::size_t waitingCount = 0;
+		for (auto& [chunk, go] : gameObjects) {
+			if (auto target = getMigrationTarget(getTargetChunk(go)))
+				target->addGameObject(chunk->detachGameObject(go));
+			else
+				waitingCount++;
 		}
+		if (waitingCount > 0)
+			logger::log(LogLevel::INFO, LogChannel::SCENE) << waitingCount << " game objects wait for their chunk to be loaded before being reassigned." << logger::endl;
 	}
 }
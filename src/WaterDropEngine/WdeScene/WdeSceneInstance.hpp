@@ -1,12 +1,18 @@
 #pragma once
 
 #include <queue>
+#include <future>
+#include <list>
+#include <unordered_set>
 
 #include "../../wde.hpp"
 #include "GameObject.hpp"
 #include "../WdeCore/Structure/Observer.hpp"
 #include "modules/CameraModule.hpp"
 #include "terrain/Chunk.hpp"
+#include "terrain/ChunkSaver.hpp"
+#include "terrain/ChunkGrid.hpp"
+#include "../WdeCommon/WdeUtils/ThreadPool.hpp"
 #include "../WdeGUI/panels/WorldPartitionPanel.hpp"
 
 namespace wde::scene {
@@ -18,7 +24,12 @@ namespace wde::scene {
 			// Scene instance methods
 			WdeSceneInstance();
 
-			/** Ticking for scene instance (called by WaterDropEngine) */
+			/**
+			 * Simulation step of the scene modules, zero or more times per frame (called by WaterDropEngine)
+			 * @param stepTime Duration of the step (in seconds)
+			 */
+			void simulate(float stepTime);
+			/** Ticking for scene instance, once per frame (called by WaterDropEngine) */
 			void tick();
 			void cleanUp();
 			void onNotify(const core::Event& event) override;
@@ -26,42 +37,67 @@ namespace wde::scene {
 
 
 			// Getters and setters
-			void setPath(const std::string& path) { _scenePath = path; }
+			/**
+			 * Sets the scene path and loads its chunks manifest
+			 * @param path
+			 */
+			void setPath(const std::string& path);
 			const std::string& getPath() const { return _scenePath; }
 			void setName(const std::string& name) { _sceneName = name; }
 			const std::string& getName() const { return _sceneName; }
 			gui::WorldPartitionPanel& getWorldPartitionPanel() { return *_worldPartitionPanel; }
+			/** @return The background writer of the chunk files */
+			ChunkSaver& getChunkSaver() { return *_chunkSaver; }
 
-			GameObject*& getActiveGameObject() { return _selectedGameObject; }
+			/** @return The game object selected in the GUI (nullptr if none or destroyed) */
+			GameObject* getActiveGameObject() const { return GameObject::find(_selectedGameObject); }
+			void setActiveGameObject(GameObject* go) { _selectedGameObject = go != nullptr ? go->getHandle() : GameObjectHandle {}; }
 			glm::ivec2 getSelectedGameObjectChunk() const { return _selectedGameObjectChunkID; }
 			/** @return The first camera in the scene that is not the editor camera */
-			GameObject* getFirstGameCamera() {
-				for (auto& c : _activeChunks) {
-					for (auto& go : c.second->getDynamicGameObjects()) {
-						auto mod = go->getModule<CameraModule>();
-						if (mod != nullptr)
-							return go.get();
-					}
-				}
-				return nullptr;
-			}
-			void setActiveCamera(GameObject* camera) { _activeCamera = camera; }
-			GameObject* getActiveCamera() const { return _activeCamera; }
+			GameObject* getFirstGameCamera();
+			/**
+			 * Register a game object with a camera module for getFirstGameCamera()
+			 * @param camera
+			 */
+			void addCamera(GameObject& camera) { _cameras.push_back(camera.getHandle()); }
+			void setActiveCamera(GameObject* camera) { _activeCamera = camera != nullptr ? camera->getHandle() : GameObjectHandle {}; }
+			/** @return The active camera (nullptr if none or destroyed) */
+			GameObject* getActiveCamera() const { return GameObject::find(_activeCamera); }
 			GameObject* getEditorCamera() { return _editorCamera.get(); }
 
 			// Chunks manager
-			std::vector<glm::ivec2>& getLoadingChunks() { return _loadingChunks; }
-			std::unordered_map<glm::ivec2, std::shared_ptr<Chunk>>& getActiveChunks() { return _activeChunks; }
-			std::unordered_map<glm::ivec2, std::shared_ptr<Chunk>>& getUnloadingChunks() { return _removingChunks; }
+			std::unordered_map<glm::ivec2, float>& getLoadingChunks() { return _loadingChunks; }
+			std::unordered_map<glm::ivec2, std::future<std::shared_ptr<Chunk>>>& getStreamingChunks() { return _streamingChunks; }
+			ChunkGrid<std::shared_ptr<Chunk>>& getActiveChunks() { return _activeChunks; }
+			ChunkGrid<std::shared_ptr<Chunk>>& getUnloadingChunks() { return _removingChunks; }
+			std::unordered_map<glm::ivec2, std::list<std::shared_ptr<Chunk>>::iterator>& getDormantChunks() { return _dormantChunksIndex; }
+			/** @return The estimated memory used by the dormant chunks (in bytes) */
+			std::size_t getDormantChunksMemorySize() const { return _dormantChunksMemorySize; }
+			/** @return Number of chunks that were revived from the dormant chunks cache */
+			uint64_t getChunkCacheHits() const { return _chunkCacheHits; }
+			/** @return Number of chunks that had to be loaded from their file */
+			uint64_t getChunkCacheMisses() const { return _chunkCacheMisses; }
 			glm::ivec2 getCurrentChunkID() const {
-				double chunkSize = Config::CHUNK_SIZE;
-				glm::ivec2 cc { 0, 0 };
-				if (_activeCamera != nullptr) {
-					cc.x = std::floor(_activeCamera->transform->position.x / chunkSize + 0.5);
-					cc.y = std::floor(_activeCamera->transform->position.z / chunkSize + 0.5);
-				}
-				return {cc.x, cc.y};
+				auto cam = getActiveCamera();
+				if (cam == nullptr)
+					return {0, 0};
+				return Chunk::getChunkID(cam->transform->position);
+			}
+			/** @return The chunk the active camera is expected to be in after Config::CHUNK_PREFETCH_FRAMES frames */
+			glm::ivec2 getPredictedChunkID() const {
+				auto cam = getActiveCamera();
+				if (cam == nullptr)
+					return {0, 0};
+				return Chunk::getChunkID(cam->transform->position + _cameraVelocity * static_cast<float>(Config::CHUNK_PREFETCH_FRAMES));
 			}
+			/** @return Number of active chunks ticked during the last frame */
+			std::size_t getTickedChunksCount() const { return _tickedChunks.size(); }
+			/** @return Number of active chunks simulated during the last simulation step */
+			std::size_t getSimulatedChunksCount() const { return _simulatedChunksCount; }
+			/** @return Number of chunks that were already active when entering the loaded area */
+			uint64_t getPrefetchHits() const { return _prefetchHits; }
+			/** @return Number of chunks that were not active yet when entering the loaded area */
+			uint64_t getPrefetchMisses() const { return _prefetchMisses; }
 			std::pair<VkDescriptorSet, VkDescriptorSetLayout>& getDefaultGlobalSet() { return _globalSetDefault; }
 			std::unique_ptr<render::Buffer>& getDefaultObjectsBuffer() { return _objectsData; }
 			std::unique_ptr<render::Buffer>& getDefaultCameraBuffer() { return _cameraData; }
@@ -69,60 +105,167 @@ namespace wde::scene {
 
 			/**
 			 * @param chunkID Unique chunk position identifier
-			 * @return The pointer to the chunk (nullptr if added to load list)
+			 * @param priority Loading priority of the chunk if it is not loaded (lowest loaded first)
+			 * @return The pointer to the chunk (nullptr if added to load list, it will then be loaded by a background thread)
 			 */
-			Chunk* getChunk(glm::ivec2 chunkID);
+			Chunk* getChunk(glm::ivec2 chunkID, float priority = 0.0f);
 			/**
 			 * Loads a chunk synchronously
 			* @param chunkID Unique chunk position identifier
 			* @return The pointer to the chunk
 			*/
 			Chunk* getChunkSync(glm::ivec2 chunkID);
+			/**
+			 * @param chunkID Unique chunk position identifier
+			 * @param distance Radius of the area (in chunks)
+			 * @return True if the chunk is in the area around the camera or around its predicted position (as of the last loaded area update)
+			 */
+			bool isChunkInArea(glm::ivec2 chunkID, int distance) const;
 			/**
 			 * Remove a chunk from the list if the chunk exists
 			 * @param chunkID
 			 */
 			void removeChunk(glm::ivec2 chunkID);
+			/**
+			 * @param chunkID Unique chunk position identifier
+			 * @return True if the chunk has game objects saved in its file (from the scene chunks manifest)
+			 */
+			bool isChunkOccupied(glm::ivec2 chunkID) const { return _occupiedChunks.contains(chunkID); }
+			/**
+			 * Updates the scene chunks manifest when a chunk is saved (written by saveChunksManifest())
+			 * @param chunkID Unique chunk position identifier
+			 * @param occupied True if the chunk has game objects
+			 */
+			void setChunkOccupied(glm::ivec2 chunkID, bool occupied);
+			/** Queues the scene chunks manifest to be written if it changed since it was last written */
+			void saveChunksManifest();
+			/**
+			 * Destroys chunk buffers once the frames in flight that may use them are done
+			 * @param buffers
+			 */
+			void releaseBuffers(std::vector<std::unique_ptr<render::Buffer>> buffers);
+			/**
+			 * Removes a chunk from the dormant chunks cache and recreates its resources
+			 * @param chunkID Unique chunk position identifier
+			 * @return The chunk (nullptr if it is not dormant)
+			 */
+			std::shared_ptr<Chunk> reviveDormantChunk(glm::ivec2 chunkID);
 
 
 			// Chunks management
-			/** Create and unload chunks */
+			/** Loads the scene chunks manifest (created from the chunk files if it doesn't exist) */
+			void loadChunksManifest();
+			/**
+			 * Requests the chunks entering the loaded area and removes the chunks leaving the unloaded area
+			 * @param center Chunk of the camera
+			 * @param predictedCenter Predicted chunk of the camera
+			 */
+			void updateLoadedArea(glm::ivec2 center, glm::ivec2 predictedCenter);
+			/** Start loading the queued chunks, create the loaded ones and unload chunks */
 			void manageChunks();
+			/** @return The threads ticking the active chunks (created with Config::CHUNK_TICK_THREADS_COUNT threads) */
+			ThreadPool& getTickThreadPool();
+			/**
+			 * @param chunkID
+			 * @param center Chunk of the camera
+			 * @return The number of simulation steps between two ticks of the chunk (Config::CHUNK_TICK_INTERVALS)
+			 */
+			static int getTickInterval(glm::ivec2 chunkID, glm::ivec2 center);
+			/** Move the dynamic game objects that left their chunk bounds during the tick to their new chunk, if it is active */
+			void migrateGameObjects();
+			/**
+			 * @param chunkID Chunk entered by a game object
+			 * @return The chunk if it is active or available without reading its file (nullptr if it is loaded in the background)
+			 */
+			Chunk* getMigrationTarget(glm::ivec2 chunkID);
 			/** Reassign game objects to nearest chunk */
 			void reassignGOToChunks();
-			/** Reorder game objects inside the scene (optimised for culling) */
-			void reorderGO();
 
 
 
 		private:
+			/** Area around the camera in which chunks are loaded */
+			struct LoadedArea {
+				bool valid = false;                 // False until the area is first computed
+				glm::ivec2 center {0, 0};          // Chunk of the camera
+				glm::ivec2 predictedCenter {0, 0}; // Predicted chunk of the camera
+				int loadedDistance = 0;            // Radius of the loaded chunks
+				int unloadedDistance = 0;          // Radius after which the chunks are unloaded
+			};
+
 			// Scene utils
 			/** Path to the scene object */
 			std::string _scenePath;
 			/** Name of the scene object */
 			std::string _sceneName;
+			/** Chunks that have game objects saved in their file (scene chunks manifest) */
+			std::unordered_set<glm::ivec2> _occupiedChunks {};
+			/** True if the chunks manifest changed since it was last written */
+			bool _chunksManifestDirty = false;
 
 
 			// Selected game objects
 			/** Selected game object chunk id */
 			glm::ivec2 _selectedGameObjectChunkID {0, 0};
-			/** Selected game object for GUI (none : nullptr) */
-			GameObject* _selectedGameObject = nullptr;
-			/** Active camera (none = nullptr) */
-			GameObject* _activeCamera = nullptr;
+			/** Selected game object for GUI (none : null handle) */
+			GameObjectHandle _selectedGameObject {};
+			/** Active camera (none = null handle) */
+			GameObjectHandle _activeCamera {};
+			/** Game objects that had a camera module when created (destroyed ones are removed on lookup) */
+			std::vector<GameObjectHandle> _cameras {};
 			/** Editor camera (none = nullptr) */
 			std::unique_ptr<GameObject> _editorCamera {};
 			/** True if this is the first tick of the scene */
 			bool _isFirstTick = true;
+			/** Position of the active camera during the last tick */
+			glm::vec3 _lastCameraPosition {0.0f};
+			/** Smoothed per-frame displacement of the active camera */
+			glm::vec3 _cameraVelocity {0.0f};
+			/** Loaded area of the last update (only updated when the camera enters a new chunk) */
+			LoadedArea _loadedArea {};
 
 
 			// Scene chunks
-			/** List of scene loading chunks (pos - chunk*) */
-			std::vector<glm::ivec2> _loadingChunks {};
-			/** List of scene active chunks (pos - chunk*) */
-			std::unordered_map<glm::ivec2, std::shared_ptr<Chunk>> _activeChunks {};
-			/** Lists of chunks that needs to be deleted (pos - chunk*) */
-			std::unordered_map<glm::ivec2, std::shared_ptr<Chunk>> _removingChunks {};
+			/** Background writer of the chunk files (declared before the chunks so that it outlives them) */
+			std::unique_ptr<ChunkSaver> _chunkSaver {};
+			/** Buffers of the released chunks, destroyed once no frame in flight uses them (remaining frames - buffers) */
+			std::deque<std::pair<int, std::vector<std::unique_ptr<render::Buffer>>>> _releasedChunksBuffers {};
+			/** Protects the released buffers (chunks release buffers while ticked by the workers) */
+			std::mutex _releasedChunksBuffersMutex {};
+			/** List of scene chunks waiting to be loaded, updated with the loaded area (pos - priority, lowest loaded first) */
+			std::unordered_map<glm::ivec2, float> _loadingChunks {};
+			/** List of chunks being loaded by a background thread (pos - loading task) */
+			std::unordered_map<glm::ivec2, std::future<std::shared_ptr<Chunk>>> _streamingChunks {};
+			/** List of scene active chunks, in a grid centred on the camera chunk (pos - chunk*) */
+			ChunkGrid<std::shared_ptr<Chunk>> _activeChunks {Config::CHUNK_UNLOADED_DISTANCE};
+			/** Lists of chunks that needs to be deleted, in a grid centred on the camera chunk (pos - chunk*) */
+			ChunkGrid<std::shared_ptr<Chunk>> _removingChunks {Config::CHUNK_UNLOADED_DISTANCE};
+			/** Threads ticking the active chunks */
+			std::unique_ptr<ThreadPool> _tickThreadPool {};
+			/** Active chunks ticked this frame */
+			std::vector<Chunk*> _tickedChunks {};
+			/** Active chunks simulated during the last step that have thread safe modules (ticked in parallel) */
+			std::vector<Chunk*> _simulatedChunks {};
+			/** Number of active chunks simulated during the last step */
+			std::size_t _simulatedChunksCount = 0;
+			/** Index of the current simulation step */
+			uint64_t _stepIndex = 0;
+			/** Game objects leaving their chunk this frame, with their chunk */
+			std::vector<std::pair<Chunk*, GameObject*>> _migratingGameObjects {};
+			/** Recently unloaded chunks without GPU resources, most recently used first */
+			std::list<std::shared_ptr<Chunk>> _dormantChunks {};
+			/** Position of the dormant chunks in the dormant chunks list (pos - iterator) */
+			std::unordered_map<glm::ivec2, std::list<std::shared_ptr<Chunk>>::iterator> _dormantChunksIndex {};
+			/** Estimated memory used by the dormant chunks (in bytes) */
+			std::size_t _dormantChunksMemorySize = 0;
+			/** Number of chunks that were revived from the dormant chunks cache */
+			uint64_t _chunkCacheHits = 0;
+			/** Number of chunks that had to be loaded from their file */
+			uint64_t _chunkCacheMisses = 0;
+			/** Number of chunks that were already active when entering the loaded area */
+			uint64_t _prefetchHits = 0;
+			/** Number of chunks that were not active yet when entering the loaded area */
+			uint64_t _prefetchMisses = 0;
 			/** Global default set */
 			std::pair<VkDescriptorSet, VkDescriptorSetLayout> _globalSetDefault {};
 
@@ -133,5 +276,24 @@ namespace wde::scene {
 			std::unique_ptr<render::Buffer> _cameraData {};
 			std::unique_ptr<render::Buffer> _objectsData {};
 			ImGuizmo::OPERATION _gizmoManipulationType = ImGuizmo::OPERATION::TRANSLATE;
+
+
+			// Helper functions
+			/**
+			 * Adds a chunk to the active chunks (and removes it if it is outside of the unloaded area)
+			 * @param chunkID Unique chunk position identifier
+			 * @param chunk
+			 */
+			void activateChunk(glm::ivec2 chunkID, const std::shared_ptr<Chunk>& chunk);
+			/**
+			 * @param chunkID Unique chunk position identifier
+			 * @param center Center of the disc
+			 * @param distance Radius of the disc (in chunks)
+			 * @return True if the chunk is in the disc
+			 */
+			static bool isChunkInDisc(glm::ivec2 chunkID, glm::ivec2 center, int distance) {
+				glm::ivec2 d = chunkID - center;
+				return d.x*d.x + d.y*d.y <= distance*distance;
+			}
 	};
 }
@@ -9,34 +9,13 @@ namespace wde::scene {
 		WDE_PROFILE_FUNCTION();
 
 		// === Create buffers ===
-		int MAX_COMMANDS = Config::MAX_CHUNK_OBJECTS_COUNT;
+		// GPU buffer that holds the scene data to describe to the compute shader
+		_gpuSceneData = std::make_unique<render::Buffer>(
+				sizeof(GPUSceneData),
+				VK_BUFFER_USAGE_UNIFORM_BUFFER_BIT);
 
-		{
-			// List of rendered indirect commands created by the compute shader
-			_indirectCommandsBuffer = std::make_unique<render::Buffer>(
-					MAX_COMMANDS * sizeof(VkDrawIndexedIndirectCommand),
-					VK_BUFFER_USAGE_STORAGE_BUFFER_BIT |  VK_BUFFER_USAGE_INDIRECT_BUFFER_BIT);
-
-			// GPU Batches
-			_gpuRenderBatches = std::make_unique<render::Buffer>(
-					MAX_COMMANDS * sizeof(GPURenderBatch),
-					VK_BUFFER_USAGE_STORAGE_BUFFER_BIT);
-
-			// GPU Objects buffer batches and IDs
-			_gpuObjectsBatches = std::make_unique<render::Buffer>(
-					Config::MAX_CHUNK_OBJECTS_COUNT * sizeof(GPUObjectBatch),
-					VK_BUFFER_USAGE_STORAGE_BUFFER_BIT);
-
-			// List of game objects IDs in the batches (will match to gl_instanceID, filled by the compute shader)
-			_gpuObjectsIDs = std::make_unique<render::Buffer>(
-					Config::MAX_CHUNK_OBJECTS_COUNT * sizeof(uint32_t),
-					VK_BUFFER_USAGE_STORAGE_BUFFER_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT);
-
-			// GPU buffer that holds the scene data to describe to the compute shader
-			_gpuSceneData = std::make_unique<render::Buffer>(
-					sizeof(GPUSceneData),
-					VK_BUFFER_USAGE_UNIFORM_BUFFER_BIT);
-		}
+		// Objects buffers (grown by createBatches() when a chunk has more game objects)
+		createObjectsBuffers(Config::CHUNK_OBJECTS_MIN_CAPACITY);
 
 
 		// === Create culling pipeline ===
@@ -48,14 +27,6 @@ namespace wde::scene {
 						.bind_buffer(1, *sceneInstance->getDefaultObjectsBuffer(), VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, VK_SHADER_STAGE_COMPUTE_BIT)
 					.build(_generalComputeSet.first, _generalComputeSet.second);
 
-			// Create compute shader resources descriptor set
-			render::DescriptorBuilder::begin()
-						.bind_buffer(0, *_gpuObjectsBatches, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, VK_SHADER_STAGE_COMPUTE_BIT)
-						.bind_buffer(1, *_gpuRenderBatches, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, VK_SHADER_STAGE_COMPUTE_BIT)
-						.bind_buffer(2, *_gpuObjectsIDs, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, VK_SHADER_STAGE_COMPUTE_BIT)
-						.bind_buffer(3, *_indirectCommandsBuffer, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, VK_SHADER_STAGE_COMPUTE_BIT)
-					.build(_computeSet.first, _computeSet.second);
-
 			// Create compute pipeline
 			_cullingPipeline = std::make_unique<render::PipelineCompute>(sceneInstance->getPath() + "data/shaders/common/culling/culling_indirect.comp");
 			_cullingPipeline->addDescriptorSet(_generalComputeSet.second);
@@ -64,12 +35,32 @@ namespace wde::scene {
 		}
 	}
 
-	void CullingInstance::createBatches(const std::vector<std::shared_ptr<GameObject>> &gameObjects) {
+	void CullingInstance::createBatches(Chunk& chunk) {
 		WDE_PROFILE_FUNCTION();
+		auto& components = chunk.getComponents();
+		auto& meshRenderers = components.getMeshRenderers();
+		uint32_t slotsCount = components.getObjectSlotsCount();
 
 		// Clear previous batches
 		_renderBatches.clear();
 
+		// Grow the objects buffers if the game objects slots do not fit anymore
+		if (slotsCount > _objectsCapacity) {
+			WDE_PROFILE_SCOPE("wde::scene::CullingInstance::createBatches::growObjectsBuffers");
+			// Previous buffers may still be used by the recorded draw commands
+			std::vector<std::unique_ptr<render::Buffer>> oldBuffers {};
+			oldBuffers.push_back(std::move(_indirectCommandsBuffer));
+			oldBuffers.push_back(std::move(_gpuRenderBatches));
+			oldBuffers.push_back(std::move(_gpuObjectsBatches));
+			oldBuffers.push_back(std::move(_gpuObjectsIDs));
+			WaterDropEngine::get().getInstance().getScene()->releaseBuffers(std::move(oldBuffers));
+
+			uint32_t capacity = _objectsCapacity;
+			while (capacity < slotsCount)
+				capacity *= 2;
+			createObjectsBuffers(capacity);
+		}
+
 		// Create batches data
 		CPURenderBatch currentBatch {};
 		resource::Mesh* lastGOMeshRef = nullptr;
@@ -85,20 +76,24 @@ namespace wde::scene {
 		auto* gpuObjectsBatches = (GPUObjectBatch*) gpuObjectsBatchesData;
 		// ------
 
-		// Fetch every game objects
+		// Push the current batch to the render batches
+		auto pushBatch = [&]() {
+			if (currentBatch.indexCount > 0) {
+				_renderBatches.push_back(currentBatch);
+				// Set gpu batch
+				gpuBatches[_renderBatches.size()-1].indexCount = _renderBatches[_renderBatches.size()-1].indexCount;
+				gpuBatches[_renderBatches.size()-1].firstIndex = _renderBatches[_renderBatches.size()-1].firstIndex;
+				gpuBatches[_renderBatches.size()-1].instanceCount = _renderBatches[_renderBatches.size()-1].instanceCount;
+			}
+		};
+
+		// Add an object to the batches (objects are indexed by their slot, goActiveID is their index in the batches)
+		_usedSlots.assign(slotsCount, false);
 		int goActiveID = 0;
-		for (const auto& go : gameObjects) {
-			auto meshModule = go->getModule<scene::MeshRendererModule>();
-
-			// If no renderer, or material, or mesh, or if render stage different from culling stage, discard object, push last batch
-			if (!go->active || meshModule == nullptr || meshModule->getMaterial() == nullptr || meshModule->getMesh() == nullptr || meshModule->getMaterial()->getRenderStage() != _renderStage) {
-				if (currentBatch.indexCount > 0) {
-					_renderBatches.push_back(currentBatch);
-					// Set gpu batch
-					gpuBatches[_renderBatches.size()-1].indexCount = _renderBatches[_renderBatches.size()-1].indexCount;
-					gpuBatches[_renderBatches.size()-1].firstIndex = _renderBatches[_renderBatches.size()-1].firstIndex;
-					gpuBatches[_renderBatches.size()-1].instanceCount = _renderBatches[_renderBatches.size()-1].instanceCount;
-				}
+		auto addObject = [&](uint32_t slot, resource::Material* mat, resource::Mesh* mesh) {
+			// If no material, or mesh, or if render stage different from culling stage, discard object, push last batch
+			if (mat == nullptr || mesh == nullptr || mat->getRenderStage() != _renderStage) {
+				pushBatch();
 
 				// No mesh and material
 				lastGOMeshRef = nullptr;
@@ -106,63 +101,20 @@ namespace wde::scene {
 
 				// Empty batch (do not draw this object)
 				currentBatch = CPURenderBatch {};
-				continue;
+				return;
 			}
+			_usedSlots[slot] = true;
 
-			// If material different from last one, push last batch
-			auto mat = meshModule->getMaterial();
-			if (currentBatch.indexCount > 0 && lastGOMaterialRef != mat) {
-				if (currentBatch.indexCount > 0) {
-					_renderBatches.push_back(currentBatch);
-					// Set gpu batch
-					gpuBatches[_renderBatches.size()-1].indexCount = _renderBatches[_renderBatches.size()-1].indexCount;
-					gpuBatches[_renderBatches.size()-1].firstIndex = _renderBatches[_renderBatches.size()-1].firstIndex;
-					gpuBatches[_renderBatches.size()-1].instanceCount = _renderBatches[_renderBatches.size()-1].instanceCount;
-				}
-
-				// Add this object to a new batch
+			// If material or mesh different from last one, push last batch and add this object to a new batch
+			if (currentBatch.indexCount > 0 && (lastGOMaterialRef != mat || lastGOMeshRef != mesh)) {
+				pushBatch();
 				currentBatch = CPURenderBatch {};
-				currentBatch.material = mat;
-				currentBatch.mesh = meshModule->getMesh();
 				currentBatch.firstIndex = goActiveID;
-				currentBatch.indexCount = 1;
-				currentBatch.instanceCount = 0;
-
-				// Set this object batch
-				gpuObjectsBatches[goActiveID].batchID = _renderBatches.size();
-				gpuObjectsBatches[goActiveID].indicesCount = meshModule->getMesh()->getIndexCount();
-				goActiveID++;
-				continue;
 			}
 			lastGOMaterialRef = mat;
-
-			// If mesh different from last one, push last batch
-			auto mesh = meshModule->getMesh();
-			if (currentBatch.indexCount > 0 && lastGOMeshRef != mesh) {
-				if (currentBatch.indexCount > 0) {
-					_renderBatches.push_back(currentBatch);
-					// Set gpu batch
-					gpuBatches[_renderBatches.size()-1].indexCount = _renderBatches[_renderBatches.size()-1].indexCount;
-					gpuBatches[_renderBatches.size()-1].firstIndex = _renderBatches[_renderBatches.size()-1].firstIndex;
-					gpuBatches[_renderBatches.size()-1].instanceCount = _renderBatches[_renderBatches.size()-1].instanceCount;
-				}
-
-				// Add this object to a new batch
-				currentBatch = CPURenderBatch {};
-				currentBatch.material = mat;
-				currentBatch.mesh = mesh;
-				currentBatch.firstIndex = goActiveID;
-				currentBatch.indexCount = 1;
-				currentBatch.instanceCount = 0;
-
-				// Set this object batch
-				gpuObjectsBatches[goActiveID].batchID = _renderBatches.size();
-				goActiveID++;
-				continue;
-			}
 			lastGOMeshRef = mesh;
 
-			// Same material and mesh
+			// Add to current batch
 			currentBatch.material = mat;
 			currentBatch.mesh = mesh;
 			currentBatch.indexCount++;
@@ -170,23 +122,42 @@ namespace wde::scene {
 				currentBatch.firstIndex = goActiveID;
 
 			// Set this object batch
-			gpuObjectsBatches[goActiveID].batchID = _renderBatches.size();
-			gpuObjectsBatches[goActiveID].indicesCount = meshModule->getMesh()->getIndexCount();
-
+			gpuObjectsBatches[slot].batchID = _renderBatches.size();
+			gpuObjectsBatches[slot].indicesCount = mesh->getIndexCount();
 			goActiveID++;
+		};
+
+		// Fetch every rendered game objects (game objects merged into the chunk static geometry are drawn by its clusters)
+		auto& staticGeometry = chunk.getStaticGeometry();
+		for (const auto& entry : meshRenderers) {
+			if (staticGeometry.isBaked(entry.objectSlot))
+				continue;
+			if (!entry.gameObject->active)
+				addObject(entry.objectSlot, nullptr, nullptr);
+			else
+				addObject(entry.objectSlot, entry.meshRenderer->getMaterial(), entry.meshRenderer->getMesh());
 		}
+		for (const auto& cluster : staticGeometry.getClusters())
+			addObject(cluster.objectSlot, cluster.material, cluster.mesh.get());
 
 		// Push last batch
-		if (currentBatch.indexCount > 0) {
-			_renderBatches.push_back(currentBatch);
-			// Set gpu batch
-			gpuBatches[_renderBatches.size()-1].indexCount = _renderBatches[_renderBatches.size()-1].indexCount;
-			gpuBatches[_renderBatches.size()-1].firstIndex = _renderBatches[_renderBatches.size()-1].firstIndex;
-			gpuBatches[_renderBatches.size()-1].instanceCount = _renderBatches[_renderBatches.size()-1].instanceCount;
+		pushBatch();
+
+		// Unused and not drawn slots are still culled by the compute shader : they are added to a last batch that is never drawn
+		if (goActiveID < static_cast<int>(slotsCount)) {
+			gpuBatches[_renderBatches.size()].firstIndex = goActiveID;
+			gpuBatches[_renderBatches.size()].indexCount = slotsCount - goActiveID;
+			gpuBatches[_renderBatches.size()].instanceCount = 0;
+			for (uint32_t slot = 0; slot < slotsCount; slot++) {
+				if (!_usedSlots[slot]) {
+					gpuObjectsBatches[slot].batchID = _renderBatches.size();
+					gpuObjectsBatches[slot].indicesCount = 0;
+				}
+			}
 		}
 
 		// Set objects count
-		_renderBatchesObjectCount = goActiveID;
+		_renderBatchesObjectCount = static_cast<int>(slotsCount);
 
 		// Unmap buffers
 		_gpuObjectsBatches->unmap();
@@ -268,6 +239,39 @@ namespace wde::scene {
 
 
 	// Helper functions
+	void CullingInstance::createObjectsBuffers(uint32_t capacity) {
+		WDE_PROFILE_FUNCTION();
+		_objectsCapacity = capacity;
+
+		// List of rendered indirect commands created by the compute shader
+		_indirectCommandsBuffer = std::make_unique<render::Buffer>(
+				_objectsCapacity * sizeof(VkDrawIndexedIndirectCommand),
+				VK_BUFFER_USAGE_STORAGE_BUFFER_BIT |  VK_BUFFER_USAGE_INDIRECT_BUFFER_BIT);
+
+		// GPU Batches
+		_gpuRenderBatches = std::make_unique<render::Buffer>(
+				_objectsCapacity * sizeof(GPURenderBatch),
+				VK_BUFFER_USAGE_STORAGE_BUFFER_BIT);
+
+		// GPU Objects buffer batches and IDs
+		_gpuObjectsBatches = std::make_unique<render::Buffer>(
+				_objectsCapacity * sizeof(GPUObjectBatch),
+				VK_BUFFER_USAGE_STORAGE_BUFFER_BIT);
+
+		// List of game objects IDs in the batches (will match to gl_instanceID, filled by the compute shader)
+		_gpuObjectsIDs = std::make_unique<render::Buffer>(
+				_objectsCapacity * sizeof(uint32_t),
+				VK_BUFFER_USAGE_STORAGE_BUFFER_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT);
+
+		// Create compute shader resources descriptor set (same layout, so the pipeline is kept)
+		render::DescriptorBuilder::begin()
+					.bind_buffer(0, *_gpuObjectsBatches, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, VK_SHADER_STAGE_COMPUTE_BIT)
+					.bind_buffer(1, *_gpuRenderBatches, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, VK_SHADER_STAGE_COMPUTE_BIT)
+					.bind_buffer(2, *_gpuObjectsIDs, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, VK_SHADER_STAGE_COMPUTE_BIT)
+					.bind_buffer(3, *_indirectCommandsBuffer, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, VK_SHADER_STAGE_COMPUTE_BIT)
+				.build(_computeSet.first, _computeSet.second);
+	}
+
 	void CullingInstance::updateScene(GameObject* cullingCamera, Chunk& chunk) {
 		WDE_PROFILE_FUNCTION();
 
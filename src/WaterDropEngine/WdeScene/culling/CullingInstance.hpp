@@ -61,12 +61,13 @@ namespace wde::scene {
 
 			// Core functions
 			/**
-			 * Generate render batches from a set of game objects and stores them to _renderBatches.
+			 * Generate render batches from a set of rendered game objects and stores them to _renderBatches.
 			 * This will update the GPU objects batch IDs, the GPU render batches list, and create a CPU render batches list.
-			 * @param gameObjects The list of culled game objects
+			 * The chunk game objects are drawn with the clusters of its baked static geometry.
+			 * @param chunk
 			 * @return The render batches vector
 			 */
-			void createBatches(const std::vector<std::shared_ptr<GameObject>>& gameObjects);
+			void createBatches(Chunk& chunk);
 
 			/**
 			 * Do culling based on it's batches for a specific scene camera
@@ -88,7 +89,8 @@ namespace wde::scene {
 			// Batches storage
 			std::pair<int, int> _renderStage;
 			std::vector<CPURenderBatch> _renderBatches {}; // List of last render scene batches
-			int _renderBatchesObjectCount = 0; // Number of objects in the last render batch
+			int _renderBatchesObjectCount = 0; // Number of objects slots culled by the compute shader
+			std::vector<bool> _usedSlots {}; // Objects slots drawn by the last render batches
 
 			// Culling data buffers
 			/** List of rendered indirect commands created by the compute shader */
@@ -101,6 +103,8 @@ namespace wde::scene {
 			std::unique_ptr<render::Buffer> _gpuObjectsIDs {};
 			/** Describes the scene data sent to the compute shader */
 			std::unique_ptr<render::Buffer> _gpuSceneData {};
+			/** Number of game objects that fit in the objects buffers (doubled when a chunk has more game objects) */
+			uint32_t _objectsCapacity = 0;
 
 
 			// Culling pipeline and pipeline resources
@@ -111,6 +115,11 @@ namespace wde::scene {
 
 
 			// Helper functions
+			/**
+			 * Creates the buffers that store data for each game object, and the compute descriptor set that references them
+			 * @param capacity Number of game objects that fit in the buffers
+			 */
+			void createObjectsBuffers(uint32_t capacity);
 			/** Update the culling scene parameters based on the scene and on it's configured camera */
 			void updateScene(GameObject* cullingCamera, Chunk& chunk);
 
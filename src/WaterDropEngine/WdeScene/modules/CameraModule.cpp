@@ -1,19 +1,11 @@
 #include "CameraModule.hpp"
 #include "../../WaterDropEngine.hpp"
+#include "../terrain/ChunkFile.hpp"
 
 namespace wde::scene {
 	CameraModule::CameraModule(GameObject &gameObject) : Module(gameObject, "Camera", ICON_FA_CAMERA) {
 		WDE_PROFILE_FUNCTION();
-		// Setup initial projection type
-		auto aspect = WaterDropEngine::get().getRender().getInstance().getSwapchain().getAspectRatio();
-		if (_projectionType == 0)
-			setOrthographicProjection(aspect * _bottomCorner.x, aspect * _topCorner.x, _bottomCorner.y, _topCorner.y, _bottomCorner.z, _topCorner.z);
-		else
-			setPerspectiveProjection(_fov, aspect, _nearPlane, _farPlane);
-
-		// If not camera as active, set this a default active camera
-		if (WaterDropEngine::get().getInstance().getScene()->getActiveCamera() == nullptr)
-			setAsActive();
+		initialize();
 	}
 
 	CameraModule::CameraModule(GameObject &gameObject, const std::string& data) : Module(gameObject, "Camera", ICON_FA_CAMERA) {
@@ -34,30 +26,46 @@ namespace wde::scene {
 		_fov = dataJ["perspective"]["fov"].get<float>();
 		_nearPlane = dataJ["perspective"]["nearPlane"].get<float>();
 		_farPlane = dataJ["perspective"]["farPlane"].get<float>();
+		initialize();
+	}
 
+	CameraModule::CameraModule(GameObject &gameObject, const BinaryData& data) : Module(gameObject, "Camera", ICON_FA_CAMERA) {
+		WDE_PROFILE_FUNCTION();
+		_projectionType = data.projectionType;
+		_bottomCorner = glm::vec3 {data.bottomCorner[0], data.bottomCorner[1], data.bottomCorner[2]};
+		_topCorner = glm::vec3 {data.topCorner[0], data.topCorner[1], data.topCorner[2]};
+		_fov = data.fov;
+		_nearPlane = data.nearPlane;
+		_farPlane = data.farPlane;
+		initialize();
+	}
+
+	void CameraModule::initialize() {
 		// Setup initial projection type
-		auto aspect = WaterDropEngine::get().getRender().getInstance().getSwapchain().getAspectRatio();
+		auto aspect = getAspectRatio();
 		if (_projectionType == 0)
 			setOrthographicProjection(aspect * _bottomCorner.x, aspect * _topCorner.x, _bottomCorner.y, _topCorner.y, _bottomCorner.z, _topCorner.z);
 		else
 			setPerspectiveProjection(_fov, aspect, _nearPlane, _farPlane);
 
 		// If not camera as active, set this a default active camera
-		if (WaterDropEngine::get().getInstance().getScene()->getActiveCamera() == nullptr)
+		auto scene = WaterDropEngine::get().getInstance().getScene();
+		scene->addCamera(_gameObject);
+		if (scene->getActiveCamera() == nullptr)
 			setAsActive();
 	}
 
 
-	void CameraModule::tick() {
+	void CameraModule::tick(float deltaTime) {
 		WDE_PROFILE_FUNCTION();
 		// Update camera object based on it's game object transform associated position and rotation
-		setViewYXZ(_gameObject.getModule<TransformModule>()->position, _gameObject.getModule<TransformModule>()->rotation);
+		updateView();
 		// setViewDirection(glm::vec3(0.0f), glm::vec3(0.5f, 0.0f, 1.0f)); // Camera look to the right
 		// setViewTarget(camera.getModule<TransformModule>().position, glm::vec3(0.0f, 0.0f, 0.0f)); // Look at center
 
 
 		// Update projection type
-		auto aspect = WaterDropEngine::get().getRender().getInstance().getSwapchain().getAspectRatio();
+		auto aspect = getAspectRatio();
 		static int lastProjectionType = _projectionType;
 		if (lastProjectionType != _projectionType) {
 			lastProjectionType = _projectionType;
@@ -207,11 +215,21 @@ namespace wde::scene {
 		return jData;
 	}
 
+	void CameraModule::serializeBinary(ChunkFileWriter& writer) {
+		BinaryData data {
+			_projectionType,
+			{ _bottomCorner.x, _bottomCorner.y, _bottomCorner.z },
+			{ _topCorner.x, _topCorner.y, _topCorner.z },
+			_fov, _nearPlane, _farPlane
+		};
+		writer.addModule(ChunkFile::ModuleType::CAMERA, data);
+	}
+
 
 
 	void CameraModule::setOrthographicProjection(float leftVal, float rightVal, float topVal, float bottomVal, float nearVal, float farVal)  {
 		// Update class values
-		auto aspect = WaterDropEngine::get().getRender().getInstance().getSwapchain().getAspectRatio();
+		auto aspect = getAspectRatio();
 		_aspect = aspect;
 		_bottomCorner = {leftVal / aspect, topVal, nearVal};
 		_topCorner = {rightVal / aspect, bottomVal, farVal};
@@ -229,9 +247,21 @@ namespace wde::scene {
 		WaterDropEngine::get().getInstance().getScene()->setActiveCamera(&_gameObject);
 	}
 
+	float CameraModule::getAspectRatio() {
+		// No swapchain in headless mode
+		if (Config::HEADLESS)
+			return static_cast<float>(Config::WIDTH) / static_cast<float>(Config::HEIGHT);
+		return WaterDropEngine::get().getRender().getInstance().getSwapchain().getAspectRatio();
+	}
+
+	void CameraModule::updateView() {
+		auto transform = _gameObject.getModule<TransformModule>();
+		setViewYXZ(transform->getInterpolatedPosition(), transform->getInterpolatedRotation());
+	}
+
 	void CameraModule::setFarPlane(float farPlane) {
 		_farPlane = farPlane;
-		auto aspect = WaterDropEngine::get().getRender().getInstance().getSwapchain().getAspectRatio();
+		auto aspect = getAspectRatio();
 		setPerspectiveProjection(_fov, aspect, _nearPlane, _farPlane);
 	}
 
@@ -8,16 +8,36 @@ namespace wde::scene {
 	 */
 	class CameraModule : public Module {
 		public:
+			/** Module type identifier */
+			static constexpr ModuleTypeID TYPE_ID = ModuleTypeID::CAMERA;
+			/** Reads the swapchain aspect ratio */
+			static constexpr ModuleTickMode TICK_MODE = ModuleTickMode::MAIN_THREAD;
+
+			/** Camera data in a binary chunk file */
+			struct BinaryData {
+				int32_t projectionType;
+				float bottomCorner[3];
+				float topCorner[3];
+				float fov;
+				float nearPlane;
+				float farPlane;
+			};
+
 			explicit CameraModule(GameObject& gameObject);
 			explicit CameraModule(GameObject& gameObject, const std::string& data);
+			explicit CameraModule(GameObject& gameObject, const BinaryData& data);
 
-			void tick() override;
+			void tick(float deltaTime) override;
 			void drawGUI() override;
 			void drawGizmo(Gizmo& gizmo) override;
 			json serialize() override;
+			void serializeBinary(ChunkFileWriter& writer) override;
+			ModuleTypeID getTypeID() const override { return TYPE_ID; }
 
 			/** Sets this camera to be the current scene viewing camera */
 			void setAsActive();
+			/** Updates the view matrix from the game object transform interpolated between the simulation steps */
+			void updateView();
 
 
 
@@ -81,6 +101,11 @@ namespace wde::scene {
 
 
 		private:
+			/** Setup the initial projection and set this camera as active if there is no active camera */
+			void initialize();
+			/** @return The width/height ratio of the swapchain (of the configured window size in headless mode) */
+			static float getAspectRatio();
+
 			/** Projection of object coordinates to Vulkan coordinates */
 			glm::mat4 _projectionMatrix {1.0f};
 
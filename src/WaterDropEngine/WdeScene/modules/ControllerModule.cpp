@@ -1,5 +1,6 @@
 #include "ControllerModule.hpp"
 #include "../../WaterDropEngine.hpp"
+#include "../terrain/ChunkFile.hpp"
 
 namespace wde::scene {
 	ControllerModule::ControllerModule(GameObject &gameObject) : Module(gameObject, "Keyboard Controller", ICON_FA_KEYBOARD) {}
@@ -11,21 +12,18 @@ namespace wde::scene {
 		_lookSpeed = dataJ["lookSpeed"].get<float>();
 	}
 
-	void ControllerModule::tick()  {
+	ControllerModule::ControllerModule(GameObject &gameObject, const BinaryData& data) : Module(gameObject, "Keyboard Controller", ICON_FA_KEYBOARD),
+		_moveSpeed(data.moveSpeed), _lookSpeed(data.lookSpeed) {}
+
+	void ControllerModule::tick(float deltaTime)  {
 		WDE_PROFILE_FUNCTION();
 		// Only active if this game object has a camera, and the camera is selected
 		auto cameraMod = WaterDropEngine::get().getInstance().getScene()->getActiveCamera();
 		if (cameraMod == nullptr || &_gameObject != cameraMod)
 			return;
 
-		auto newTime = std::chrono::steady_clock::now();
-		auto deltaTime =
-				std::chrono::time_point_cast<std::chrono::milliseconds>(newTime).time_since_epoch()
-				- std::chrono::time_point_cast<std::chrono::milliseconds>(_lastTime).time_since_epoch();
-		_lastTime = newTime;
-
 		// Move in plane XZ given the keyboard inputs
-		input::InputController::moveInPlaneXZ((float) deltaTime.count() / 1000.0f, _gameObject, _moveSpeed, _lookSpeed);
+		input::InputController::moveInPlaneXZ(deltaTime, _gameObject, _moveSpeed, _lookSpeed);
 	}
 
 	void ControllerModule::drawGUI() {
@@ -45,4 +43,8 @@ namespace wde::scene {
 		jData["lookSpeed"] = _lookSpeed;
 		return jData;
 	}
+
+	void ControllerModule::serializeBinary(ChunkFileWriter& writer) {
+		writer.addModule(ChunkFile::ModuleType::CONTROLLER, BinaryData {_moveSpeed, _lookSpeed});
+	}
 }
@@ -7,20 +7,31 @@
 namespace wde::scene {
 	class ControllerModule : public Module {
 		public:
+			/** Module type identifier */
+			static constexpr ModuleTypeID TYPE_ID = ModuleTypeID::CONTROLLER;
+			/** Reads the input and the active camera */
+			static constexpr ModuleTickMode TICK_MODE = ModuleTickMode::MAIN_THREAD;
+
+			/** Controller data in a binary chunk file */
+			struct BinaryData {
+				float moveSpeed;
+				float lookSpeed;
+			};
+
 			// Constructors
 			explicit ControllerModule(GameObject &gameObject);
 			explicit ControllerModule(GameObject &gameObject, const std::string& data);
+			explicit ControllerModule(GameObject &gameObject, const BinaryData& data);
 
 			// Core functions
-			void tick() override;
+			void tick(float deltaTime) override;
 			void drawGUI() override;
 			json serialize() override;
+			void serializeBinary(ChunkFileWriter& writer) override;
+			ModuleTypeID getTypeID() const override { return TYPE_ID; }
 
 
 		private:
-			// Class data
-			std::chrono::time_point<std::chrono::steady_clock> _lastTime = std::chrono::steady_clock::now();
-
 			// Movement speed
 			float _moveSpeed {20.0f};
 			float _lookSpeed {1.5f};
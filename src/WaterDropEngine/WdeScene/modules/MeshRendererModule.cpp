@@ -7,9 +7,19 @@ namespace wde::scene {
 	MeshRendererModule::MeshRendererModule(GameObject &gameObject, const std::string &data) : Module(gameObject, "Mesh Renderer", ICON_FA_GHOST) {
 		WDE_PROFILE_FUNCTION();
 		auto dataJ = json::parse(data);
-		auto& wde = WaterDropEngine::get();
 		_materialName = dataJ["material"].get<std::string>();
 		_meshName = dataJ["mesh"].get<std::string>();
+		loadResources();
+	}
+
+	MeshRendererModule::MeshRendererModule(GameObject &gameObject, std::string_view materialName, std::string_view meshName)
+			: Module(gameObject, "Mesh Renderer", ICON_FA_GHOST), _meshName(meshName), _materialName(materialName) {
+		WDE_PROFILE_FUNCTION();
+		loadResources();
+	}
+
+	void MeshRendererModule::loadResources() {
+		auto& wde = WaterDropEngine::get();
 		_material = wde.getResourceManager().load<resource::Material>(wde.getInstance().getScene()->getPath() + "data/materials/" + _materialName);
 		_mesh = wde.getResourceManager().load<resource::Mesh>(wde.getInstance().getScene()->getPath() + "data/meshes/" + _meshName);
 	}
@@ -108,4 +118,9 @@ namespace wde::scene {
 		jData["mesh"] = _meshName;
 		return jData;
 	}
+
+	void MeshRendererModule::serializeBinary(ChunkFileWriter& writer) {
+		BinaryData data {writer.addString(_materialName), writer.addString(_meshName)};
+		writer.addModule(ChunkFile::ModuleType::MESH_RENDERER, data);
+	}
 }
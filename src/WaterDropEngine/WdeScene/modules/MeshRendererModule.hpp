@@ -6,6 +6,7 @@
 #include "../../WdeResourceManager/resources/Material.hpp"
 #include "../../WdeResourceManager/resources/Mesh.hpp"
 #include "../GameObject.hpp"
+#include "../terrain/ChunkFile.hpp"
 
 namespace wde::scene {
 	/**
@@ -13,11 +14,30 @@ namespace wde::scene {
 	 */
 	class MeshRendererModule : public Module {
 		public:
+			/** Module type identifier */
+			static constexpr ModuleTypeID TYPE_ID = ModuleTypeID::MESH_RENDERER;
+			/** Module tick mode */
+			static constexpr ModuleTickMode TICK_MODE = ModuleTickMode::NONE;
+
+			/** Mesh renderer data in a binary chunk file */
+			struct BinaryData {
+				ChunkFile::StringRef material;
+				ChunkFile::StringRef mesh;
+			};
+
 			explicit MeshRendererModule(GameObject& gameObject);
 			explicit MeshRendererModule(GameObject& gameObject, const std::string& data);
+			/**
+			 * @param gameObject
+			 * @param materialName Name of the material file
+			 * @param meshName Name of the mesh file
+			 */
+			explicit MeshRendererModule(GameObject& gameObject, std::string_view materialName, std::string_view meshName);
 			~MeshRendererModule() override;
 			void drawGUI() override;
 			json serialize() override;
+			void serializeBinary(ChunkFileWriter& writer) override;
+			ModuleTypeID getTypeID() const override { return TYPE_ID; }
 
 
 			// Getters and setters
@@ -28,6 +48,9 @@ namespace wde::scene {
 
 
 		private:
+			/** Load the material and the mesh from their names */
+			void loadResources();
+
 			// Core data
 			/** Selected game object mesh */
 			resource::Mesh* _mesh = nullptr;
@@ -5,6 +5,27 @@
 
 namespace wde::scene {
 	class GameObject;
+	class ChunkFileWriter;
+
+	/** Identifier of each module type (index of the module in its game object modules slot table) */
+	enum class ModuleTypeID : uint32_t {
+		TRANSFORM     = 0,
+		MESH_RENDERER = 1,
+		CAMERA        = 2,
+		CONTROLLER    = 3,
+		COUNT         = 4
+	};
+
+	/**
+	 * How the chunks tick the modules of a type (declared by each module class as TICK_MODE).
+	 * Module classes override tick() if and only if their mode is not NONE (checked when the chunks register the module types).
+	 * TransformModule does not tick : its changes are detected when the chunks update the matrices.
+	 */
+	enum class ModuleTickMode : uint32_t {
+		NONE,        // The module tick does nothing, the module is never ticked by the chunks
+		THREAD_SAFE, // Ticked with the chunk, possibly on a worker thread
+		MAIN_THREAD  // Ticked on the main thread before the chunks (uses global state such as the input or the swapchain)
+	};
 
 	/**
 	 * A class that represents a GameObject module
@@ -16,19 +37,27 @@ namespace wde::scene {
 			~Module() override = default;
 
 			// Inherited methods
-			/** Tick for the module */
-			virtual void tick() {};
+			/** @return The type identifier of the module (its class TYPE_ID) */
+			virtual ModuleTypeID getTypeID() const = 0;
+			/**
+			 * Tick for the module
+			 * @param deltaTime Time since the last tick of the module (in seconds)
+			 */
+			virtual void tick(float deltaTime) {};
 			/** Draw the module GUI */
 			virtual void drawGUI() {};
 			/** Draw the gizmo elements to the scene */
 			virtual void drawGizmo(Gizmo& gizmo) {};
 			/** @return the serialized module data */
 			virtual json serialize() { return {}; }
+			/** Write the module data to a binary chunk file */
+			virtual void serializeBinary(ChunkFileWriter& writer) {};
 
 
 			// Getters and setters
 			std::string getName() const { return _name; }
 			std::string getIcon() const { return _icon; }
+			GameObject& getGameObject() const { return _gameObject; }
 
 
 		protected:
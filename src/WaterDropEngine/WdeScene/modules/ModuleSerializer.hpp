@@ -5,6 +5,7 @@
 #include "MeshRendererModule.hpp"
 #include "CameraModule.hpp"
 #include "ControllerModule.hpp"
+#include "../terrain/ChunkFile.hpp"
 
 namespace wde::scene {
 	/**
@@ -40,6 +41,34 @@ namespace wde::scene {
 					throw WdeException(LogChannel::SCENE, "Trying to load a module '" + moduleName + "' that isn't referenced in ModuleSerializer.");
 			}
 
+			/**
+			 * Add a new module to a game object from a binary chunk file
+			 * @param reader The chunk file containing the module
+			 * @param module The module entry in the chunk file
+			 * @param go Corresponding game object
+			 */
+			static void addModuleFromBinary(const ChunkFileReader& reader, const ChunkFile::ModuleEntry& module, GameObject& go) {
+				WDE_PROFILE_FUNCTION();
+				switch (module.type) {
+					case ChunkFile::ModuleType::TRANSFORM:
+						go.transform->setConfig(reader.getBlob<TransformModule::BinaryData>(module));
+						break;
+					case ChunkFile::ModuleType::MESH_RENDERER: {
+						auto data = reader.getBlob<MeshRendererModule::BinaryData>(module);
+						go.addModule<MeshRendererModule>(reader.getString(data.material), reader.getString(data.mesh));
+						break;
+					}
+					case ChunkFile::ModuleType::CAMERA:
+						go.addModule<CameraModule>(reader.getBlob<CameraModule::BinaryData>(module));
+						break;
+					case ChunkFile::ModuleType::CONTROLLER:
+						go.addModule<ControllerModule>(reader.getBlob<ControllerModule::BinaryData>(module));
+						break;
+					default:
+						throw WdeException(LogChannel::SCENE, "Trying to load a module of type " + std::to_string(static_cast<uint32_t>(module.type)) + " that isn't referenced in ModuleSerializer.");
+				}
+			}
+
 			/**
 			 * Remove a module given a name
 			 * @param moduleName
@@ -47,13 +76,11 @@ namespace wde::scene {
 			 */
 			static void removeModuleFromName(const std::string moduleName, GameObject& go) {
 				WDE_PROFILE_FUNCTION();
-				int index = 0;
 				for (auto& mod : go.getModules()) {
 					if (mod->getName() == moduleName) {
-						go.getModules().erase(go.getModules().begin() + index);
+						go.removeModule(mod.get());
 						return;
 					}
-					index++;
 				}
 			}
 
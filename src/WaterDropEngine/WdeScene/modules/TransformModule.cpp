@@ -1,13 +1,20 @@
 #include "TransformModule.hpp"
 #include "../GameObject.hpp"
+#include "../terrain/ChunkFile.hpp"
 
 namespace wde::scene {
+	uint64_t TransformModule::_currentFrame = 1;
+	std::atomic<uint64_t> TransformModule::_lastVersion {0};
+	std::atomic<uint64_t> TransformModule::_staticChangesCount {0};
+	uint64_t TransformModule::_currentStep = 1;
+	float TransformModule::_alpha = 1.0f;
+
 	TransformModule::TransformModule(GameObject &gameObject) : Module(gameObject, "Transform", ICON_FA_GLOBE) {}
 
 	TransformModule::~TransformModule() {
 		WDE_PROFILE_FUNCTION();
 		_parent = nullptr;
-		_childrenIDs.clear();
+		_children.clear();
 	}
 
 	void TransformModule::setConfig(const std::string &data) {
@@ -31,15 +38,24 @@ namespace wde::scene {
 		};
 	}
 
-	void TransformModule::tick() {};
+	void TransformModule::setConfig(const BinaryData& data) {
+		position = glm::vec3 {data.position[0], data.position[1], data.position[2]};
+		rotation = glm::vec3 {data.rotation[0], data.rotation[1], data.rotation[2]};
+		scale = glm::vec3 {data.scale[0], data.scale[1], data.scale[2]};
+	}
 
 	void TransformModule::drawGUI() {
 #ifdef WDE_GUI_ENABLED
 		WDE_PROFILE_FUNCTION();
 
+		glm::vec3 lastPosition = position;
+		glm::vec3 lastRotation = rotation;
+		glm::vec3 lastScale = scale;
 		gui::GUIRenderer::addVec3Button("Position", position);
 		gui::GUIRenderer::addVec3Button("Rotation", rotation);
 		gui::GUIRenderer::addVec3Button("Scale", scale, 1.0f);
+		if (position != lastPosition || rotation != lastRotation || scale != lastScale)
+			markChanged();
 #endif
 	}
 
@@ -56,50 +72,173 @@ namespace wde::scene {
 		return jData;
 	}
 
+	void TransformModule::serializeBinary(ChunkFileWriter& writer) {
+		BinaryData data {
+			{ position.x, position.y, position.z },
+			{ rotation.x, rotation.y, rotation.z },
+			{ scale.x, scale.y, scale.z }
+		};
+		writer.addModule(ChunkFile::ModuleType::TRANSFORM, data);
+	}
+
 
 
 	void TransformModule::setParent(TransformModule *parent) {
 		WDE_PROFILE_FUNCTION();
-		// Remove last parent children ID
+		// Remove from last parent children
 		if (_parent != nullptr)
-			_parent->_childrenIDs.erase(std::remove(_parent->_childrenIDs.begin(), _parent->_childrenIDs.end(), _gameObject.getID()), _parent->_childrenIDs.end());
+			_parent->_children.erase(std::remove(_parent->_children.begin(), _parent->_children.end(), _gameObject.getHandle()), _parent->_children.end());
 		// Change parent
 		_parent = parent;
+		_matrixDirty = true;
+		_updatedFrame = 0;
 		// Add children to new parent
-		_parent->_childrenIDs.push_back(static_cast<int>(_gameObject.getID()));
+		if (_parent != nullptr)
+			_parent->_children.push_back(_gameObject.getHandle());
+
+		// The chunk of the game object lists its parented transforms
+		_gameObject.invalidateModules();
+	}
+
+	const glm::mat4& TransformModule::getTransform() {
+		updateTransform();
+		return _worldTransform;
+	}
+
+	void TransformModule::markChanged() {
+		_matrixDirty = true;
+		_gameObject.setDirty(true);
+		if (_gameObject.isStatic())
+			_staticChangesCount++;
+	}
+
+	void TransformModule::updateTransform() {
+		if (_updatedFrame == _currentFrame)
+			return;
+		_updatedFrame = _currentFrame;
+
+		// Static transforms only change with markChanged() (their values are not compared)
+		bool changed = _localChanged;
+		_localChanged = false;
+		bool isStatic = _gameObject.isStatic();
+		if (isStatic && !_matrixDirty && !changed && _parent == nullptr)
+			return;
+
+		// Local matrix
+		if (_matrixDirty || !isStatic) {
+			glm::vec3 pos = getInterpolatedPosition();
+			glm::vec3 rot = getInterpolatedRotation();
+			glm::vec3 sc = getInterpolatedScale();
+			if (_matrixDirty || pos != _matrixPosition || rot != _matrixRotation || sc != _matrixScale) {
+				// Moved since the last matrices (the chunk of the game object must be saved)
+				if (!_matrixDirty)
+					_gameObject.setDirty(true);
+				_localTransform = computeLocalTransform(pos, rot, sc);
+				_matrixPosition = pos;
+				_matrixRotation = rot;
+				_matrixScale = sc;
+				_matrixDirty = false;
+				changed = true;
+			}
+		}
+
+		// World matrix (parent updated first)
+		if (_parent != nullptr && _parent != this) {
+			_parent->updateTransform();
+			if (changed || _parentVersion != _parent->_worldVersion) {
+				_worldTransform = _parent->_worldTransform * _localTransform;
+				_parentVersion = _parent->_worldVersion;
+				changed = true;
+			}
+		}
+		else if (changed)
+			_worldTransform = _localTransform;
+
+		if (changed)
+			_worldVersion = ++_lastVersion;
+	}
+
+	bool TransformModule::needsLocalUpdate() const {
+		if (_updatedFrame == _currentFrame)
+			return false;
+		if (_gameObject.isStatic())
+			return _matrixDirty;
+		return _matrixDirty || getInterpolatedPosition() != _matrixPosition || getInterpolatedRotation() != _matrixRotation
+			|| getInterpolatedScale() != _matrixScale;
+	}
+
+	void TransformModule::setLocalTransform(const glm::mat4& localTransform) {
+		// Moved since the last matrices (the chunk of the game object must be saved)
+		if (!_matrixDirty)
+			_gameObject.setDirty(true);
+		_localTransform = localTransform;
+		_matrixPosition = getInterpolatedPosition();
+		_matrixRotation = getInterpolatedRotation();
+		_matrixScale = getInterpolatedScale();
+		_matrixDirty = false;
+		_localChanged = true;
+	}
+
+	void TransformModule::storeState() {
+		_previousPosition = position;
+		_previousRotation = rotation;
+		_previousScale = scale;
+		_stateStep = _currentStep;
+	}
+
+	glm::vec3 TransformModule::getInterpolatedPosition() const {
+		if (_stateStep != _currentStep)
+			return position;
+		return glm::mix(_previousPosition, position, _alpha);
+	}
+
+	glm::vec3 TransformModule::getInterpolatedRotation() const {
+		if (_stateStep != _currentStep)
+			return rotation;
+		// Angles wrapped around during the step are not interpolated
+		glm::vec3 rot = glm::mix(_previousRotation, rotation, _alpha);
+		for (glm::length_t i = 0; i < 3; i++) {
+			if (glm::abs(rotation[i] - _previousRotation[i]) > glm::pi<float>())
+				rot[i] = rotation[i];
+		}
+		return rot;
+	}
+
+	glm::vec3 TransformModule::getInterpolatedScale() const {
+		if (_stateStep != _currentStep)
+			return scale;
+		return glm::mix(_previousScale, scale, _alpha);
 	}
 
-	glm::mat4 TransformModule::getTransform() const {
-		const float c3 = glm::cos(rotation.z);
-		const float s3 = glm::sin(rotation.z);
-		const float c2 = glm::cos(rotation.x);
-		const float s2 = glm::sin(rotation.x);
-		const float c1 = glm::cos(rotation.y);
-		const float s1 = glm::sin(rotation.y);
+	glm::mat4 TransformModule::computeLocalTransform(const glm::vec3& pos, const glm::vec3& rot, const glm::vec3& sc) {
+		const float c3 = glm::cos(rot.z);
+		const float s3 = glm::sin(rot.z);
+		const float c2 = glm::cos(rot.x);
+		const float s2 = glm::sin(rot.x);
+		const float c1 = glm::cos(rot.y);
+		const float s1 = glm::sin(rot.y);
 
 		auto mat = glm::mat4{
 				{
-					 scale.x * (c1 * c3 + s1 * s2 * s3),
-				     scale.x * (c2 * s3),
-	                 scale.x * (c1 * s2 * s3 - c3 * s1),
+					 sc.x * (c1 * c3 + s1 * s2 * s3),
+				     sc.x * (c2 * s3),
+	                 sc.x * (c1 * s2 * s3 - c3 * s1),
                      0.0f,
 				},
 				{
-					 scale.y * (c3 * s1 * s2 - c1 * s3),
-			         scale.y * (c2 * c3),
-	                 scale.y * (c1 * c3 * s2 + s1 * s3),
+					 sc.y * (c3 * s1 * s2 - c1 * s3),
+			         sc.y * (c2 * c3),
+	                 sc.y * (c1 * c3 * s2 + s1 * s3),
                      0.0f,
 				},
 				{
-					 scale.z * (c2 * s1),
-				     scale.z * (-s2),
-	                 scale.z * (c1 * c2),
+					 sc.z * (c2 * s1),
+				     sc.z * (-s2),
+	                 sc.z * (c1 * c2),
                      0.0f,
 				},
-				{position.x, position.y, position.z, 1.0f}
+				{pos.x, pos.y, pos.z, 1.0f}
 		};
-		if (_parent != nullptr && _parent != this)
-			mat = _parent->getTransform() * mat;
 		return mat;
 	}
 
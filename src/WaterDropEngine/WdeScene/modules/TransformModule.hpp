@@ -1,6 +1,9 @@
 #pragma once
 
+#include <atomic>
+
 #include "Module.hpp"
+#include "../GameObjectRegistry.hpp"
 #include "../../WdeGUI/GUIRenderer.hpp"
 #define GLM_ENABLE_EXPERIMENTAL
 #include <glm/gtx/matrix_decompose.hpp>
@@ -8,30 +11,86 @@
 namespace wde::scene {
 	class TransformModule : public Module {
 		public:
+			/** Module type identifier */
+			static constexpr ModuleTypeID TYPE_ID = ModuleTypeID::TRANSFORM;
+			/** Changes are detected when the chunks update the matrices (see markChanged() for the static game objects) */
+			static constexpr ModuleTickMode TICK_MODE = ModuleTickMode::NONE;
+
+			/** Transform data in a binary chunk file */
+			struct BinaryData {
+				float position[3];
+				float rotation[3];
+				float scale[3];
+			};
+
 			explicit TransformModule(GameObject& gameObject);
 			~TransformModule() override;
 
 			void setConfig(const std::string& data);
-			void tick() override;
+			void setConfig(const BinaryData& data);
 			void drawGUI() override;
 			json serialize() override;
+			void serializeBinary(ChunkFileWriter& writer) override;
+			ModuleTypeID getTypeID() const override { return TYPE_ID; }
 
 
 
 			// Getters and setters
-			/** Return the corresponding transform matrix : Translation * Ry * Rx * Rz * scale */
-			glm::mat4 getTransform() const;
+			/**
+			 * Return the corresponding world transform matrix : Parent * Translation * Ry * Rx * Rz * scale
+			 * (cached, updated at most once per frame, and interpolated between the two last simulation steps)
+			 */
+			const glm::mat4& getTransform();
+			/** @return Changed each time the world transform matrix changes (versions are unique across every transform) */
+			uint64_t getTransformVersion() const { return _worldVersion; }
+			/** Recomputes the cached matrices if the transform or one of its parents changed since the last frame (parents are updated first) */
+			void updateTransform();
+			/** @return True if the local transform matrix will be recomputed on the next update of this frame */
+			bool needsLocalUpdate() const;
+			/**
+			 * Set the local transform matrix computed from the current position, rotation and scale (by a transform batch),
+			 * so that the next update of this frame only computes the world matrix
+			 * @param localTransform Translation * Ry * Rx * Rz * scale
+			 */
+			void setLocalTransform(const glm::mat4& localTransform);
+			/**
+			 * Starts a new frame : the cached matrices are checked for changes on their next access
+			 * @param alpha Position of the frame between the two last simulation steps (0 = last step, 1 = next step)
+			 */
+			static void nextFrame(float alpha) { _currentFrame++; _alpha = alpha; }
+			/**
+			 * Must be called after changing the position, rotation or scale of a static game object
+			 * (the chunks do not check the static transforms for changes)
+			 */
+			void markChanged();
+			/** @return Incremented each time a static transform is changed (see markChanged()) */
+			static uint64_t getStaticChangesCount() { return _staticChangesCount; }
+
+
+
+			// Simulation steps interpolation
+			/** Starts a new simulation step : the states stored before the last step are no longer interpolated */
+			static void nextStep() { _currentStep++; }
+			/** Stores the current position, rotation and scale as the state before this simulation step */
+			void storeState();
+			/** @return The position between the state before the last simulation step and the current one (used by the matrices) */
+			glm::vec3 getInterpolatedPosition() const;
+			/** @return The rotation between the state before the last simulation step and the current one (used by the matrices) */
+			glm::vec3 getInterpolatedRotation() const;
+			/** @return The scale between the state before the last simulation step and the current one (used by the matrices) */
+			glm::vec3 getInterpolatedScale() const;
 
 
 
 			// Parents and children handling
 			/**
 			 * Set game object transform parent
-			 * @param parent
+			 * @param parent (nullptr to remove the parent)
 			 */
 			void setParent(TransformModule* parent);
 			TransformModule* getParent() { return _parent; }
-			const std::vector<int>& getChildrenIDs() { return _childrenIDs; }
+			/** @return The handles of the children game objects (destroyed children resolve to nullptr) */
+			const std::vector<GameObjectHandle>& getChildren() { return _children; }
 
 			/**
 			 * Extract position, rotation and scale from a transform
@@ -45,7 +104,7 @@ namespace wde::scene {
 
 
 
-			// Core parameters
+			// Core parameters (call markChanged() after changing them on a static game object)
 			/** The game object world position */
 			glm::vec3 position {0.0f, 0.0f, 0.0f};
 			/** The game object world axis rotation */
@@ -57,7 +116,47 @@ namespace wde::scene {
 		private:
 			/** Module transform parent */
 			TransformModule* _parent = nullptr;
-			/** Module children IDs */
-			std::vector<int> _childrenIDs {};
+			/** Module children game objects */
+			std::vector<GameObjectHandle> _children {};
+
+			// Cached matrices
+			/** Cached local transform matrix */
+			glm::mat4 _localTransform {1.0f};
+			/** Cached world transform matrix */
+			glm::mat4 _worldTransform {1.0f};
+			/** Values used to compute the local transform matrix */
+			glm::vec3 _matrixPosition {0.0f, 0.0f, 0.0f};
+			glm::vec3 _matrixRotation {0.0f, 0.0f, 0.0f};
+			glm::vec3 _matrixScale {1.0f, 1.0f, 1.0f};
+			/** True if the matrices must be recomputed (set when the parent changes or by markChanged()) */
+			bool _matrixDirty = true;
+			/** True if the local transform matrix was set since the last update */
+			bool _localChanged = false;
+			/** Version of the world transform matrix */
+			uint64_t _worldVersion = 0;
+			/** Version of the parent world transform matrix used to compute the world transform matrix */
+			uint64_t _parentVersion = 0;
+			/** Frame of the last matrices update */
+			uint64_t _updatedFrame = 0;
+			/** Current frame index */
+			static uint64_t _currentFrame;
+			/** Last version given to a world transform matrix */
+			static std::atomic<uint64_t> _lastVersion;
+			/** Number of changes of static transforms */
+			static std::atomic<uint64_t> _staticChangesCount;
+
+			/** @return The local transform matrix : Translation * Ry * Rx * Rz * scale */
+			static glm::mat4 computeLocalTransform(const glm::vec3& pos, const glm::vec3& rot, const glm::vec3& sc);
+
+			// State before the last simulation step
+			glm::vec3 _previousPosition {0.0f, 0.0f, 0.0f};
+			glm::vec3 _previousRotation {0.0f, 0.0f, 0.0f};
+			glm::vec3 _previousScale {1.0f, 1.0f, 1.0f};
+			/** Simulation step of the stored state (interpolated only during the frames following this step) */
+			uint64_t _stateStep = 0;
+			/** Current simulation step index */
+			static uint64_t _currentStep;
+			/** Position of the current frame between the two last simulation steps */
+			static float _alpha;
 	};
 }
@@ -8,81 +8,29 @@ namespace wde::scene {
 	bool Chunk::_cullingEnabled = true; // Culling enabled by default
 	bool Chunk::_showGOBoundingBox = false; // Do not show every objects collision box by default
 
-	Chunk::Chunk(WdeSceneInstance* sceneInstance, glm::ivec2 pos) : _sceneInstance(sceneInstance), _pos(pos) {
+	Chunk::Chunk(WdeSceneInstance* sceneInstance, glm::ivec2 pos, bool loadFile) : _sceneInstance(sceneInstance), _pos(pos) {
 		WDE_PROFILE_FUNCTION();
 		logger::log(LogLevel::DEBUG, LogChannel::SCENE) << "Loading chunk (" << _pos.x << ", " << _pos.y << ")." << logger::endl;
 
-		// Create buffers
-		{
-			WDE_PROFILE_SCOPE("wde::scene::Chunk::Chunk::createBuffers");
-
-			// Camera data buffer
-			_cameraData = std::make_unique<render::Buffer>(sizeof(GPUCameraData), VK_BUFFER_USAGE_UNIFORM_BUFFER_BIT);
-
-			// Objects buffer
-			_objectsData = std::make_unique<render::Buffer>(sizeof(scene::GameObject::GPUGameObjectData) * Config::MAX_CHUNK_OBJECTS_COUNT,
-															VK_BUFFER_USAGE_STORAGE_BUFFER_BIT);
-
-			// Create global descriptor set
-			render::DescriptorBuilder::begin()
-					.bind_buffer(0, *_cameraData, VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER, VK_SHADER_STAGE_VERTEX_BIT)
-					.bind_buffer(1, *_objectsData, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, VK_SHADER_STAGE_VERTEX_BIT)
-				.build(_globalSet.first, _globalSet.second);
-
-			// GPU buffer that holds the scene data to describe to the compute shader
-			_cullingSceneBuffer = std::make_unique<render::Buffer>(
-					sizeof(CullingInstance::GPUSceneData),
-					VK_BUFFER_USAGE_UNIFORM_BUFFER_BIT);
-
-			// Create culling set
-			render::DescriptorBuilder::begin()
-					.bind_buffer(0, *_cullingSceneBuffer, VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER, VK_SHADER_STAGE_COMPUTE_BIT)
-					.bind_buffer(1, *_objectsData, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, VK_SHADER_STAGE_COMPUTE_BIT)
-				.build(_cullingSet.first, _cullingSet.second);
-		}
-
-		// Load chunk
-		{
+		// Load chunk (the binary file is used, unless the JSON file has been edited since the last save)
+		if (loadFile) {
 			WDE_PROFILE_SCOPE("wde::scene::Chunk::Chunk::loadChunkFile");
 
-			// Check if file chunk exist, if not create empty chunk
-			auto path = _sceneInstance->getPath();
-			bool exist = WdeFileUtils::fileExist(path + "chunk/chunk_" + std::to_string(pos.x) + "-" + std::to_string(pos.y) + ".json");
-
-			// No chunk data
-			if (exist) {
-				// Check chunk file format
-				auto fileData = json::parse(WdeFileUtils::readFile(path + "chunk/chunk_" + std::to_string(pos.x) + "-" + std::to_string(pos.y) + ".json"));
-				if (fileData["type"] != "chunk")
-					throw WdeException(LogChannel::SCENE, "Trying to load a non-chunk JSON object.");
-				if (fileData["data"]["id"]["x"].get<int>() != pos.x || fileData["data"]["id"]["y"].get<int>() != pos.y)
-					throw WdeException(LogChannel::SCENE, "Chunk at (" + std::to_string(pos.x) + "," + std::to_string(pos.y) + ") has incorrect ID in JSON file.");
-
-				// Load chunk game objects
-				std::unordered_map<uint32_t, uint32_t> oldToNewIds {}; // <oldID, newID>
-				for (const auto& goData : fileData["data"]["gameObjects"]) {
-					if (goData["type"] != "gameObject")
-						throw WdeException(LogChannel::SCENE, "Trying to load a non-gameObject resource type as a gameObject.");
-
-					// Create game object
-					auto go = createGameObject(goData["name"], goData["data"]["static"].get<bool>());
-					go->active = goData["data"]["active"].get<bool>();
-
-					// Add parent id to list
-					oldToNewIds.emplace(goData["data"]["id"].get<uint32_t>(), go->getID());
-
-					// Create game object modules
-					for (const auto& modData : goData["modules"])
-						ModuleSerializer::addModuleFromName(modData["name"], to_string(modData["data"]), *go);
-				}
+			// Make sure the chunk is not being saved
+			auto path = getFilePath();
+			_sceneInstance->getChunkSaver().waitForFile(path + ChunkFile::EXTENSION);
+			_sceneInstance->getChunkSaver().waitForFile(path + ".json");
 
-				// Set game object parents and children
-				_gameObjects.resize(fileData["data"]["gameObjects"].size());
-				for (int i = 0; i < fileData["data"]["gameObjects"].size(); i++) {
-					auto goData = fileData["data"]["gameObjects"][i];
-					if (goData["modules"][0]["name"] == "Transform" && goData["modules"][0]["data"]["parentID"].get<int>() != -1) // First module should always be the transform module
-						_gameObjects[i]->transform->setParent(_gameObjects[oldToNewIds.at(goData["modules"][0]["data"]["parentID"].get<int>())]->transform);
-				}
+			// Check if file chunk exist, if not create empty chunk
+			bool binaryExist = WdeFileUtils::fileExist(path + ChunkFile::EXTENSION);
+			bool jsonExist = WdeFileUtils::fileExist(path + ".json");
+			if (jsonExist && (!binaryExist || std::filesystem::last_write_time(path + ".json") > std::filesystem::last_write_time(path + ChunkFile::EXTENSION))) {
+				importJSON(path + ".json");
+				_isDirty = true; // Chunks imported from JSON are saved again in the binary format
+			}
+			else if (binaryExist) {
+				loadBinary(path + ChunkFile::EXTENSION);
+				_isDirty = false;
 			}
 		}
 
@@ -92,12 +40,341 @@ namespace wde::scene {
 		}
 	}
 
+	void Chunk::loadBinary(const std::string& path) {
+		WDE_PROFILE_FUNCTION();
+
+		// Map chunk file (kept until the pending modules are created)
+		_chunkFile = std::make_unique<ChunkFileReader>(path);
+		auto& header = _chunkFile->getHeader();
+		if (header.chunkX != _pos.x || header.chunkY != _pos.y)
+			throw WdeException(LogChannel::SCENE, "Chunk at (" + std::to_string(_pos.x) + "," + std::to_string(_pos.y) + ") has incorrect ID in binary file.");
+
+		// Load chunk game objects
+		_gameObjects.reserve(header.objectsCount);
+		for (uint32_t i = 0; i < header.objectsCount; i++) {
+			auto obj = _chunkFile->getObject(i);
+			if (uint64_t(obj.firstModule) + obj.modulesCount > header.modulesCount)
+				throw WdeException(LogChannel::SCENE, "Chunk at (" + std::to_string(_pos.x) + "," + std::to_string(_pos.y) + ") has corrupted modules table.");
+
+			// Create game object
+			auto go = createGameObject(std::string(_chunkFile->getString(obj.name)), (obj.flags & ChunkFile::STATIC) != 0);
+			go->active = (obj.flags & ChunkFile::ACTIVE) != 0;
+
+			// Create game object modules (only the transform can be created outside of the main thread)
+			for (uint32_t m = obj.firstModule; m < obj.firstModule + obj.modulesCount; m++) {
+				auto mod = _chunkFile->getModule(m);
+				if (mod.type == ChunkFile::ModuleType::TRANSFORM)
+					ModuleSerializer::addModuleFromBinary(*_chunkFile, mod, *go);
+				else
+					_pendingModules.push_back({go.get(), "", "", mod});
+			}
+		}
+
+		// Set game object parents and children
+		for (uint32_t i = 0; i < header.objectsCount; i++) {
+			auto parentIndex = _chunkFile->getObject(i).parentIndex;
+			if (parentIndex >= 0 && parentIndex < static_cast<int32_t>(header.objectsCount))
+				_gameObjects[i]->transform->setParent(_gameObjects[parentIndex]->transform);
+		}
+
+		// No module to create, file can be released
+		if (_pendingModules.empty())
+			_chunkFile.reset();
+	}
+
+	void Chunk::importJSON(const std::string& path) {
+		WDE_PROFILE_FUNCTION();
+
+		// Check chunk file format
+		auto fileData = json::parse(WdeFileUtils::readFile(path));
+		if (fileData["type"] != "chunk")
+			throw WdeException(LogChannel::SCENE, "Trying to load a non-chunk JSON object.");
+		if (fileData["data"]["id"]["x"].get<int>() != _pos.x || fileData["data"]["id"]["y"].get<int>() != _pos.y)
+			throw WdeException(LogChannel::SCENE, "Chunk at (" + std::to_string(_pos.x) + "," + std::to_string(_pos.y) + ") has incorrect ID in JSON file.");
+
+		// Load chunk game objects
+		std::unordered_map<uint32_t, GameObject*> fileIDs {}; // <ID in file, game object>
+		for (const auto& goData : fileData["data"]["gameObjects"]) {
+			if (goData["type"] != "gameObject")
+				throw WdeException(LogChannel::SCENE, "Trying to load a non-gameObject resource type as a gameObject.");
+
+			// Create game object
+			auto go = createGameObject(goData["name"], goData["data"]["static"].get<bool>());
+			go->active = goData["data"]["active"].get<bool>();
+
+			// Add parent id to list
+			fileIDs.emplace(goData["data"]["id"].get<uint32_t>(), go.get());
+
+			// Create game object modules (only the transform can be created outside of the main thread)
+			for (const auto& modData : goData["modules"]) {
+				if (modData["name"] == "Transform")
+					ModuleSerializer::addModuleFromName(modData["name"], to_string(modData["data"]), *go);
+				else
+					_pendingModules.push_back({go.get(), modData["name"].get<std::string>(), to_string(modData["data"])});
+			}
+		}
+
+		// Set game object parents and children
+		for (const auto& goData : fileData["data"]["gameObjects"]) {
+			if (goData["modules"][0]["name"] == "Transform" && goData["modules"][0]["data"]["parentID"].get<int>() != -1) // First module should always be the transform module
+				fileIDs.at(goData["data"]["id"].get<uint32_t>())->transform->setParent(fileIDs.at(goData["modules"][0]["data"]["parentID"].get<uint32_t>())->transform);
+		}
+	}
+
+	void Chunk::createResources() {
+		WDE_PROFILE_FUNCTION();
+		if (_isReady && !_isDormant)
+			return;
+
+		// Create modules that depends on the engine resources
+		{
+			WDE_PROFILE_SCOPE("wde::scene::Chunk::createResources::createModules");
+			for (auto& mod : _pendingModules) {
+				if (mod.name.empty())
+					ModuleSerializer::addModuleFromBinary(*_chunkFile, mod.binaryModule, *mod.gameObject);
+				else
+					ModuleSerializer::addModuleFromName(mod.name, mod.config, *mod.gameObject);
+			}
+			_pendingModules.clear();
+			_chunkFile.reset();
+		}
+
+		// Merge static game objects on a worker thread (the clusters are uploaded by preTick() once merged)
+		bakeStaticGeometry();
+
+		// Create buffers (chunks without mesh renderers create them with their first one)
+		if (hasRenderableObjects(getComponents()))
+			createBuffers();
+
+		_isReady = true;
+		_isDormant = false;
+	}
+
+	void Chunk::createBuffers() {
+		WDE_PROFILE_FUNCTION();
+
+		// Camera data buffer
+		_cameraData = std::make_unique<render::Buffer>(sizeof(GPUCameraData), VK_BUFFER_USAGE_UNIFORM_BUFFER_BIT);
+
+		// GPU buffer that holds the scene data to describe to the compute shader
+		_cullingSceneBuffer = std::make_unique<render::Buffer>(
+				sizeof(CullingInstance::GPUSceneData),
+				VK_BUFFER_USAGE_UNIFORM_BUFFER_BIT);
+
+		// Objects buffer and descriptor sets
+		createObjectsBuffer(getObjectsCapacityFor(getComponents().getObjectSlotsCount()));
+	}
+
+	void Chunk::createObjectsBuffer(uint32_t capacity) {
+		WDE_PROFILE_FUNCTION();
+
+		// Objects buffer
+		_objectsCapacity = capacity;
+		_objectsData = std::make_unique<render::Buffer>(sizeof(scene::GameObject::GPUGameObjectData) * _objectsCapacity,
+														VK_BUFFER_USAGE_STORAGE_BUFFER_BIT);
+		_uploadedObjects.clear(); // Every game object is uploaded to the new buffer
+
+		// Create global descriptor set
+		render::DescriptorBuilder::begin()
+				.bind_buffer(0, *_cameraData, VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER, VK_SHADER_STAGE_VERTEX_BIT)
+				.bind_buffer(1, *_objectsData, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, VK_SHADER_STAGE_VERTEX_BIT)
+			.build(_globalSet.first, _globalSet.second);
+
+		// Create culling set
+		render::DescriptorBuilder::begin()
+				.bind_buffer(0, *_cullingSceneBuffer, VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER, VK_SHADER_STAGE_COMPUTE_BIT)
+				.bind_buffer(1, *_objectsData, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, VK_SHADER_STAGE_COMPUTE_BIT)
+			.build(_cullingSet.first, _cullingSet.second);
+	}
+
+	uint32_t Chunk::getObjectsCapacityFor(std::size_t count) {
+		auto capacity = static_cast<uint32_t>(Config::CHUNK_OBJECTS_MIN_CAPACITY);
+		while (capacity < count)
+			capacity *= 2;
+		return capacity;
+	}
+
+	std::vector<std::unique_ptr<render::Buffer>> Chunk::releaseBuffers() {
+		WDE_PROFILE_FUNCTION();
+		std::vector<std::unique_ptr<render::Buffer>> buffers {};
+		if (!hasBuffers())
+			return buffers;
+
+		// Release buffers (descriptor sets are recreated with the buffers)
+		buffers.push_back(std::move(_cameraData));
+		buffers.push_back(std::move(_objectsData));
+		buffers.push_back(std::move(_cullingSceneBuffer));
+		_objectsCapacity = 0;
+		return buffers;
+	}
+
+	std::vector<std::unique_ptr<render::Buffer>> Chunk::releaseResources() {
+		WDE_PROFILE_FUNCTION();
+		if (!_isReady || _isDormant)
+			return {};
+
+		_isDormant = true;
+		auto buffers = releaseBuffers();
+		for (auto& buffer : _staticGeometry.release(_components))
+			buffers.push_back(std::move(buffer));
+		return buffers;
+	}
+
+	void Chunk::bakeStaticGeometry() {
+		WDE_PROFILE_FUNCTION();
+		releaseStaticGeometry();
+		if (!Config::CHUNK_STATIC_BAKING || Config::HEADLESS)
+			return;
+		_staticGeometry.startBake(getComponents(), _pos);
+	}
+
+	void Chunk::releaseStaticGeometry() {
+		if (!_staticGeometry.empty() || _staticGeometry.isBaking())
+			_sceneInstance->releaseBuffers(_staticGeometry.release(_components));
+	}
+
+	bool Chunk::hasRenderableObjects(const ChunkComponents& components) {
+		// Nothing is drawn in headless mode
+		if (Config::HEADLESS)
+			return false;
+		return !components.getMeshRenderers().empty();
+	}
+
+	const ChunkComponents& Chunk::getComponents() {
+		if (_componentsDirty) {
+			_components.build(_gameObjects);
+			_staticTransformsOutdated = true;
+			_componentsDirty = false;
+		}
+		return _components;
+	}
+
+
+
+	// Game objects lists
+	void Chunk::insertGameObject(const std::shared_ptr<GameObject>& go) {
+		auto& typeList = go->isStatic() ? _gameObjectsStatic : _gameObjectsDynamic;
+		go->chunk = this;
+		go->chunkIndex = static_cast<uint32_t>(_gameObjects.size());
+		go->chunkTypeIndex = static_cast<uint32_t>(typeList.size());
+		_gameObjects.push_back(go);
+		typeList.push_back(go);
+		_isDirty = true;
+		_componentsDirty = true;
+	}
+
+	std::shared_ptr<GameObject> Chunk::detachGameObject(GameObject* go) {
+		WDE_PROFILE_FUNCTION();
+		if (go->chunkIndex >= _gameObjects.size() || _gameObjects[go->chunkIndex].get() != go)
+			throw WdeException(LogChannel::SCENE, "Cannot detach game object '" + go->name + "' from a chunk that does not contain it.");
+
+		// Swap with the last game object of each list and pop it
+		std::shared_ptr<GameObject> goPtr = std::move(_gameObjects[go->chunkIndex]);
+		if (go->chunkIndex != _gameObjects.size() - 1) {
+			_gameObjects[go->chunkIndex] = std::move(_gameObjects.back());
+			_gameObjects[go->chunkIndex]->chunkIndex = go->chunkIndex;
+		}
+		_gameObjects.pop_back();
+
+		auto& typeList = go->isStatic() ? _gameObjectsStatic : _gameObjectsDynamic;
+		if (go->chunkTypeIndex != typeList.size() - 1) {
+			typeList[go->chunkTypeIndex] = std::move(typeList.back());
+			typeList[go->chunkTypeIndex]->chunkTypeIndex = go->chunkTypeIndex;
+		}
+		typeList.pop_back();
+
+		go->chunk = nullptr;
+		_isDirty = true;
+		_componentsDirty = true;
+		return goPtr;
+	}
+
+	void Chunk::reindexGameObjects() {
+		for (std::size_t i = 0; i < _gameObjects.size(); i++)
+			_gameObjects[i]->chunkIndex = static_cast<uint32_t>(i);
+		for (std::size_t i = 0; i < _gameObjectsStatic.size(); i++)
+			_gameObjectsStatic[i]->chunkTypeIndex = static_cast<uint32_t>(i);
+		for (std::size_t i = 0; i < _gameObjectsDynamic.size(); i++)
+			_gameObjectsDynamic[i]->chunkTypeIndex = static_cast<uint32_t>(i);
+	}
+
+	void Chunk::markDeletedGameObjects() {
+		// Mark the game objects to delete by their index (ignoring game objects not in this chunk)
+		_deletedGameObjects.assign(_gameObjects.size(), false);
+		for (GameObject* go : _gameObjectsToDelete) {
+			if (go->chunkIndex < _gameObjects.size() && _gameObjects[go->chunkIndex].get() == go)
+				_deletedGameObjects[go->chunkIndex] = true;
+		}
+	}
+
+	void Chunk::deleteGameObjects() {
+		WDE_PROFILE_FUNCTION();
+		if (!_gameObjectsToDelete.empty()) {
+			markDeletedGameObjects();
+			for (GameObject* go : _gameObjectsToDelete) {
+				if (go->chunk == this && _deletedGameObjects[go->chunkIndex])
+					go->chunk = nullptr;
+			}
+
+			// Compact the lists in a single pass each (the game objects keep their order)
+			auto isDeleted = [this](const auto& x) { return _deletedGameObjects[x->chunkIndex]; };
+			_gameObjectsStatic.erase(std::remove_if(_gameObjectsStatic.begin(), _gameObjectsStatic.end(), isDeleted), _gameObjectsStatic.end());
+			_gameObjectsDynamic.erase(std::remove_if(_gameObjectsDynamic.begin(), _gameObjectsDynamic.end(), isDeleted), _gameObjectsDynamic.end());
+			_gameObjects.erase(std::remove_if(_gameObjects.begin(), _gameObjects.end(), isDeleted), _gameObjects.end());
+
+			// Clear game objects to delete
+			_gameObjectsToDelete.clear();
+			reindexGameObjects();
+			_componentsDirty = true;
+		}
+	}
+
+	std::size_t Chunk::getBuffersMemorySize() const {
+		if (!hasBuffers())
+			return 0;
+		return _cameraData->getSize() + _objectsData->getSize() + _cullingSceneBuffer->getSize();
+	}
+
+	std::size_t Chunk::getMemorySize() const {
+		std::size_t size = sizeof(Chunk);
+		for (const auto& go : _gameObjects) {
+			size += sizeof(GameObject) + go->name.capacity();
+			size += go->getModules().size() * (sizeof(Module) + sizeof(glm::mat4) * 2); // Estimation of the modules data
+		}
+		return size;
+	}
+
 	void Chunk::save() {
 		WDE_PROFILE_FUNCTION();
 		logger::log(LogLevel::DEBUG, LogChannel::SCENE) << "Saving chunk (" << _pos.x << ", " << _pos.y << ")." << logger::endl;
 
-		// Make sure directory is created
-		std::filesystem::create_directories(_sceneInstance->getPath() + "chunk/");
+		// Export as JSON for hand editing (queued first so that the binary file stays the most recent one)
+		if (Config::CHUNK_EXPORT_JSON)
+			exportJSON();
+
+		// Index of each game object in the file
+		std::unordered_map<const TransformModule*, int32_t> indices {};
+		for (int32_t i = 0; i < static_cast<int32_t>(_gameObjects.size()); i++)
+			indices.emplace(_gameObjects[i]->transform, i);
+
+		// Game objects list
+		ChunkFileWriter writer {_pos};
+		for (const auto& go : _gameObjects) {
+			auto parent = go->transform->getParent();
+			writer.addObject(go->name, parent != nullptr && indices.contains(parent) ? indices.at(parent) : -1, go->active, go->isStatic());
+			for (auto& mod : go->getModules())
+				mod->serializeBinary(writer);
+		}
+
+		// Queue file to be written by the background thread
+		_sceneInstance->getChunkSaver().write(getFilePath() + ChunkFile::EXTENSION, writer.getData());
+		_sceneInstance->setChunkOccupied(_pos, !_gameObjects.empty());
+		_isDirty = false;
+	}
+
+	void Chunk::exportJSON() {
+		WDE_PROFILE_FUNCTION();
+		logger::log(LogLevel::DEBUG, LogChannel::SCENE) << "Exporting chunk (" << _pos.x << ", " << _pos.y << ") to JSON." << logger::endl;
 
 		// Chunk data
 		json chunkData {};
@@ -105,6 +382,11 @@ namespace wde::scene {
 		chunkData["data"]["id"]["x"] = _pos.x;
 		chunkData["data"]["id"]["y"] = _pos.y;
 
+		// Index of each game object in the file
+		std::unordered_map<const TransformModule*, int> indices {};
+		for (int i = 0; i < static_cast<int>(_gameObjects.size()); i++)
+			indices.emplace(_gameObjects[i]->transform, i);
+
 		// Game objects list
 		std::vector<json> goJSONArr {};
 		goJSONArr.resize(_gameObjects.size());
@@ -123,6 +405,10 @@ namespace wde::scene {
 			std::vector<json> modulesJSON;
 			for (auto& mod : res->getModules())
 				modulesJSON.push_back(ModuleSerializer::serializeModule(*mod));
+
+			// Parents are referenced by their index in the file
+			auto parent = res->transform->getParent();
+			modulesJSON[0]["data"]["parentID"] = parent != nullptr && indices.contains(parent) ? indices.at(parent) : -1;
 			goJSON["modules"] = modulesJSON;
 
 			// Output file
@@ -130,115 +416,246 @@ namespace wde::scene {
 		}
 		chunkData["data"]["gameObjects"] = goJSONArr;
 
-		// Serialize and write to file
-		std::ofstream outputData {_sceneInstance->getPath() + "chunk/chunk_" + std::to_string(_pos.x) + "-" + std::to_string(_pos.y) +  ".json", std::ofstream::out};
-		outputData << to_string(chunkData);
-		outputData.close();
+		// Serialize and queue file to be written by the background thread
+		_sceneInstance->getChunkSaver().write(getFilePath() + ".json", to_string(chunkData));
 	}
 
 	Chunk::~Chunk() {
 		WDE_PROFILE_FUNCTION();
 
-		// Wait for device
-		WaterDropEngine::get().getRender().getInstance().waitForDevicesReady();
-
-		// Save chunk data
-		if (!_gameObjects.empty())
+		// Save chunk data if it changed (chunks never created were dropped while loading)
+		if (_isReady && _isDirty)
 			save();
 
 		// Remove game objects
 		_sceneInstance = nullptr;
+		_pendingModules.clear();
+		for (auto& go : _gameObjects)
+			go->chunk = nullptr;
 		_gameObjectsDynamic.clear();
 		_gameObjectsStatic.clear();
 		_gameObjects.clear();
 	}
 
 
+	bool Chunk::preSimulate(float stepTime, bool simulate) {
+		WDE_PROFILE_FUNCTION();
+		deleteGameObjects();
+		_simulationTime += stepTime;
+		_simulatedLastStep = simulate;
+		if (!simulate)
+			return false;
+		_tickDeltaTime = _simulationTime;
+		_simulationTime = 0.0f;
+		_simulatedSinceTick = true;
+
+		// Keep the state before the step to interpolate the rendered transforms (static game objects are not simulated)
+		for (auto& go : _gameObjectsDynamic)
+			go->transform->storeState();
+
+		// Tick the modules that use global state
+		getComponents().tickModules(ModuleTickMode::MAIN_THREAD, _tickDeltaTime);
+		return true;
+	}
+
+	void Chunk::simulate() {
+		WDE_PROFILE_FUNCTION();
+		// Tick the other modules, by type
+		getComponents().tickModules(ModuleTickMode::THREAD_SAFE, _tickDeltaTime);
+	}
+
+	bool Chunk::preTick() {
+		WDE_PROFILE_FUNCTION();
+		_uploadedBytes = 0;
+		deleteGameObjects();
+
+		// Clusters merged by the worker thread (their GPU meshes are created here, and their slots uploaded by tick())
+		bool baked = false;
+		if (_staticGeometry.isBaking()) {
+			getComponents();
+			baked = _staticGeometry.finishBake(_components);
+		}
+
+		// Chunks whose game objects changed are ticked anyway, so that their buffers match their game objects
+		if (!baked && !_simulatedSinceTick && !_simulatedLastStep && !_componentsDirty && _staticChangesCount == TransformModule::getStaticChangesCount())
+			return false;
+		_simulatedSinceTick = false;
+		return true;
+	}
+
+	void Chunk::updateParentedTransforms() {
+		WDE_PROFILE_FUNCTION();
+		for (auto transform : getComponents().getParentedTransforms())
+			transform->updateTransform();
+	}
+
 	void Chunk::tick() {
 		WDE_PROFILE_FUNCTION();
+		// The components are resolved once, so that they are not rebuilt in the middle of the tick
+		auto& components = getComponents();
 
-		// Remove game objects to delete
+		// Update game objects world matrices (parents before children, the parented transforms were updated by updateParentedTransforms())
+		// The static transforms are only updated after they changed (see TransformModule::markChanged()) or when the components are rebuilt
+		bool updateStaticTransforms;
 		{
-			WDE_PROFILE_SCOPE("wde::scene::Chunk::tick::deleteGameObjects");
-
-			auto sceneInstance = WaterDropEngine::get().getInstance().getScene();
-			if (!_gameObjectsToDelete.empty()) {
-				// Remove selected and active camera
-				for (GameObject* go : _gameObjectsToDelete) {
-					if (sceneInstance->getSelectedGameObjectChunk() == _pos && sceneInstance->getActiveGameObject() == go)
-						sceneInstance->getActiveGameObject() = nullptr;
+			WDE_PROFILE_SCOPE("wde::scene::Chunk::tick::updateTransforms");
+			uint64_t staticChangesCount = TransformModule::getStaticChangesCount();
+			updateStaticTransforms = _staticTransformsOutdated || _staticChangesCount != staticChangesCount;
+			_staticTransformsOutdated = false;
+			_staticChangesCount = staticChangesCount;
+			auto& transforms = updateStaticTransforms ? components.getTransforms() : components.getDynamicTransforms();
+
+			// Compute changed local matrices together
+			_transformBatch.clear();
+			_transformBatchModules.clear();
+			for (auto transform : transforms) {
+				if (transform->needsLocalUpdate()) {
+					_transformBatch.add(transform->getInterpolatedPosition(), transform->getInterpolatedRotation(), transform->getInterpolatedScale());
+					_transformBatchModules.push_back(transform);
 				}
+			}
+			_transformBatch.compute(_transformBatchMatrices);
+			for (std::size_t i = 0; i < _transformBatchModules.size(); i++)
+				_transformBatchModules[i]->setLocalTransform(_transformBatchMatrices[i]);
 
-				// Remove from static list
-				_gameObjectsStatic.erase(std::remove_if(_gameObjectsStatic.begin(), _gameObjectsStatic.end(), [this](const auto&x) {
-					return std::find(_gameObjectsToDelete.begin(), _gameObjectsToDelete.end(), x.get()) != _gameObjectsToDelete.end();
-				}), _gameObjectsStatic.end());
+			// Compute world matrices
+			for (auto transform : transforms)
+				transform->updateTransform();
+		}
 
-				// Remove from dynamic list
-				_gameObjectsDynamic.erase(std::remove_if(_gameObjectsDynamic.begin(), _gameObjectsDynamic.end(), [this](const auto&x) {
-					return std::find(_gameObjectsToDelete.begin(), _gameObjectsToDelete.end(), x.get()) != _gameObjectsToDelete.end();
-				}), _gameObjectsDynamic.end());
+		// Update game objects (moved game objects were marked as changed by their transform)
+		{
+			WDE_PROFILE_SCOPE("wde::scene::Chunk::tick::dynamicGameObjects");
+			_leavingGameObjects.clear();
+			if (updateStaticTransforms) {
+				for (auto &go: _gameObjectsStatic) {
+					if (go->isDirty()) {
+						_isDirty = true;
+						go->setDirty(false);
+					}
+				}
+			}
+			for (auto &go: _gameObjectsDynamic) {
+				if (go->isDirty()) {
+					_isDirty = true;
+					go->setDirty(false);
+				}
 
-				// Remove from game objects
-				_gameObjects.erase(std::remove_if(_gameObjects.begin(), _gameObjects.end(), [this](const auto&x) {
-					return std::find(_gameObjectsToDelete.begin(), _gameObjectsToDelete.end(), x.get()) != _gameObjectsToDelete.end();
-				}), _gameObjects.end());
+				// Game objects leaving the chunk bounds are moved by the scene (hierarchies stay in their chunk)
+				if (go->transform->getParent() == nullptr && go->transform->getChildren().empty()
+					&& getChunkID(go->transform->position) != _pos)
+					_leavingGameObjects.push_back(go.get());
+			}
 
-				// Clear game objects to delete
-				_gameObjectsToDelete.clear();
+			// Game objects removed while ticking are deleted from this chunk (filtered by their deletion mark, in linear time)
+			if (!_gameObjectsToDelete.empty() && !_leavingGameObjects.empty()) {
+				markDeletedGameObjects();
+				_leavingGameObjects.erase(std::remove_if(_leavingGameObjects.begin(), _leavingGameObjects.end(), [this](GameObject* go) {
+					return _deletedGameObjects[go->chunkIndex];
+				}), _leavingGameObjects.end());
 			}
 		}
 
-		// Update game objects
-		{
-			WDE_PROFILE_SCOPE("wde::scene::Chunk::tick::dynamicGameObjects");
+		// Release the baked static geometry if one of its game objects changed (drawn separately until the chunk is saved)
+		if (!_staticGeometry.empty() && _staticGeometry.isOutdated(components))
+			releaseStaticGeometry();
+
+		// Sort the mesh renderers again if their materials or meshes changed
+		_components.updateRenderOrder();
 
-			for (auto &go: _gameObjectsDynamic)
-				go->tick();
+		// Update game objects buffers (buffers are created, grown and released on the main thread)
+		if (needsBuffersUpdate(components))
+			_buffersUpdatePending = true;
+		else if (hasBuffers())
+			uploadGOBuffers(components);
+	}
+
+	void Chunk::postTick() {
+		WDE_PROFILE_FUNCTION();
+		if (_buffersUpdatePending) {
+			_buffersUpdatePending = false;
+			updateGOBuffers();
 		}
+	}
 
-		// Update game objects buffers
-		updateGOBuffers();
+	bool Chunk::needsBuffersUpdate(const ChunkComponents& components) const {
+		if (!hasRenderableObjects(components))
+			return hasBuffers();
+		return !hasBuffers() || components.getObjectSlotsCount() > _objectsCapacity;
 	}
 
 	void Chunk::updateGOBuffers() {
 		WDE_PROFILE_FUNCTION();
-
-		// Update camera buffer data
-		auto scene = WaterDropEngine::get().getInstance().getScene();
-		if (scene->getActiveCamera() == nullptr)
-			logger::log(LogLevel::WARN, LogChannel::SCENE) << "No camera in scene." << logger::endl;
-		else {
-			auto cameraModule = scene->getActiveCamera()->getModule<scene::CameraModule>();
-			if (cameraModule != nullptr) {
-				// New data
-				GPUCameraData cameraData {};
-				cameraData.proj = cameraModule->getProjection();
-				cameraData.view = cameraModule->getView();
-
-				// Map data
-				void *data = _cameraData->map();
-				memcpy(data, &cameraData, sizeof(GPUCameraData));
-				_cameraData->unmap();
-			}
+		_uploadedBytes = 0;
+
+		// Buffers are created with the first mesh renderer and released with the last one
+		auto& components = getComponents();
+		if (!hasRenderableObjects(components)) {
+			if (hasBuffers())
+				_sceneInstance->releaseBuffers(releaseBuffers());
+			return;
 		}
+		if (!hasBuffers())
+			createBuffers();
+
+		// Grow the objects buffer if the game objects slots do not fit anymore (the descriptor sets are rebuilt with it)
+		if (components.getObjectSlotsCount() > _objectsCapacity) {
+			WDE_PROFILE_SCOPE("wde::scene::Chunk::updateGOBuffers::growObjectsBuffer");
+			std::vector<std::unique_ptr<render::Buffer>> oldBuffers {};
+			oldBuffers.push_back(std::move(_objectsData));
+			_sceneInstance->releaseBuffers(std::move(oldBuffers));
+			createObjectsBuffer(getObjectsCapacityFor(components.getObjectSlotsCount()));
+		}
+		uploadGOBuffers(components);
+	}
 
-
-		// Update every game objects translate
-		void *data = _objectsData->map();
-		auto* objectsData = (scene::GameObject::GPUGameObjectData*) data;
-		uint32_t iterator = 0;
-		for (auto& go : _gameObjects) {
-			// If no mesh or material, continue
-			auto mesh = go->getModule<scene::MeshRendererModule>();
-			if (!go->active || mesh == nullptr || mesh->getMesh() == nullptr || mesh->getMaterial() == nullptr)
-				continue;
+	void Chunk::uploadGOBuffers(const ChunkComponents& components) {
+		WDE_PROFILE_FUNCTION();
+		auto& meshRenderers = components.getMeshRenderers();
+
+		// Update the slots of the new or moved game objects only (static game objects are uploaded once)
+		if (_uploadedObjects.size() < components.getObjectSlotsCount())
+			_uploadedObjects.resize(components.getObjectSlotsCount());
+		scene::GameObject::GPUGameObjectData* objectsData = nullptr;
+		auto uploadObject = [&](uint32_t slot, const glm::mat4& transform, uint64_t transformVersion, glm::vec4 collisionSphere) {
+			// Skip unchanged data (transform versions are unique, so a new game object in a reused slot is uploaded)
+			auto& uploaded = _uploadedObjects[slot];
+			if (uploaded.transformVersion == transformVersion && uploaded.collisionSphere == collisionSphere)
+				return;
 
 			// Set data
-			objectsData[iterator].transformWorldSpace = go->transform->getTransform();
-			objectsData[iterator++].collisionSphere = mesh->getMesh()->getCollisionSphere();
+			if (objectsData == nullptr)
+				objectsData = (scene::GameObject::GPUGameObjectData*) _objectsData->map();
+			objectsData[slot].transformWorldSpace = transform;
+			objectsData[slot].collisionSphere = collisionSphere;
+			uploaded.transformVersion = transformVersion;
+			uploaded.collisionSphere = collisionSphere;
+			_uploadedBytes += sizeof(scene::GameObject::GPUGameObjectData);
+		};
+		for (auto& entry : meshRenderers) {
+			// If no mesh, continue
+			auto mesh = entry.meshRenderer->getMesh();
+			if (mesh == nullptr)
+				continue;
+			auto& transform = entry.transform->getTransform();
+			uploadObject(entry.objectSlot, transform, entry.transform->getTransformVersion(), mesh->getCollisionSphere());
 		}
-		_objectsData->unmap();
+
+		// Static geometry clusters (vertices are already in world space)
+		for (auto& cluster : _staticGeometry.getClusters())
+			uploadObject(cluster.objectSlot, glm::mat4 {1.0f}, UINT64_MAX, cluster.mesh->getCollisionSphere());
+		if (objectsData != nullptr)
+			_objectsData->unmap();
+	}
+
+	void Chunk::uploadCameraData(const GPUCameraData& cameraData) {
+		WDE_PROFILE_FUNCTION();
+		if (!hasBuffers())
+			return;
+		void *data = _cameraData->map();
+		memcpy(data, &cameraData, sizeof(GPUCameraData));
+		_cameraData->unmap();
+		_uploadedBytes += sizeof(GPUCameraData);
 	}
 
 	void Chunk::bind(render::CommandBuffer &commandBuffer, resource::Material *material) const {
@@ -256,6 +673,7 @@ namespace wde::scene {
 		GameObject* cam = _sceneInstance->getActiveCamera();
 		auto scene = WaterDropEngine::get().getInstance().getScene();
 		GameObject* oldSelected = scene->getActiveGameObject();
+		GameObject* selected = oldSelected;
 
 		// Setup scene components list
 		gui::GUIRenderer::pushWindowTabStyle();
@@ -290,7 +708,7 @@ namespace wde::scene {
 #ifdef WDE_ENGINE_MODE_DEBUG
 				if (scene->getEditorCamera() != nullptr) {
 					ImGui::TableNextRow();
-					drawGUIForGo(scene->getEditorCamera(), scene->getActiveGameObject());
+					drawGUIForGo(scene->getEditorCamera(), selected);
 				}
 #endif
 
@@ -298,7 +716,7 @@ namespace wde::scene {
 				for (auto& go : _gameObjects) {
 					if (go->transform->getParent() == nullptr) {
 						ImGui::TableNextRow();
-						drawGUIForGo(go.get(), scene->getActiveGameObject());
+						drawGUIForGo(go.get(), selected);
 					}
 				}
 				ImGui::EndTable();
@@ -307,11 +725,12 @@ namespace wde::scene {
 
 		// Selected game object changed
 		{
-			if (oldSelected != scene->getActiveGameObject()) {
+			if (oldSelected != selected) {
 				if (oldSelected != nullptr)
 					oldSelected->setSelected(false);
-				if (scene->getActiveGameObject() != nullptr)
-					scene->getActiveGameObject()->setSelected(true);
+				if (selected != nullptr)
+					selected->setSelected(true);
+				scene->setActiveGameObject(selected);
 			}
 		}
 
@@ -342,6 +761,8 @@ namespace wde::scene {
 					scene->getActiveGameObject()->transform->position = position;
 					scene->getActiveGameObject()->transform->rotation = rotation;
 					scene->getActiveGameObject()->transform->scale = scale;
+					scene->getActiveGameObject()->transform->markChanged();
+					_isDirty = true;
 				}
 			}
 		}
@@ -358,8 +779,13 @@ namespace wde::scene {
 		gui::GUIRenderer::popWindowTabStyle();
 		ImGui::PushFont(ImGui::GetIO().FontDefault);
 		ImGui::Dummy(ImVec2(0.0f, 0.15f));
-		if (scene->getActiveGameObject() != nullptr)
+		if (scene->getActiveGameObject() != nullptr) {
 			scene->getActiveGameObject()->drawGUI();
+			if (scene->getActiveGameObject() != nullptr && scene->getActiveGameObject()->isDirty()) {
+				_isDirty = true;
+				scene->getActiveGameObject()->setDirty(false);
+			}
+		}
 		ImGui::End();
 		ImGui::PopFont();
 #endif
@@ -369,13 +795,17 @@ namespace wde::scene {
 
 
 
+	std::string Chunk::getFilePath() const {
+		return _sceneInstance->getPath() + "chunk/chunk_" + std::to_string(_pos.x) + "-" + std::to_string(_pos.y);
+	}
+
 	void Chunk::drawGUIForGo(GameObject* go, GameObject*& selected) const {
 #ifdef WDE_GUI_ENABLED
 		WDE_PROFILE_FUNCTION();
 		std::string typeName;
-		if (go->getModule<MeshRendererModule>())
+		if (go->hasModule<MeshRendererModule>())
 			typeName = "Mesh Entity";
-		else if (go->getModule<CameraModule>())
+		else if (go->hasModule<CameraModule>())
 			typeName = "Camera";
 
 		// Enable / disabled icon
@@ -388,8 +818,10 @@ namespace wde::scene {
 		}
 		ImGui::PushID(static_cast<int>(go->getID()) + 216846351);
 		auto textS = ImGui::CalcTextSize("      ");
-		if ((go->active && ImGui::Selectable(" " ICON_FA_EYE, false, 0, textS)) || (!go->active && ImGui::Selectable(" " ICON_FA_EYE_SLASH, false, 0, textS)))
+		if ((go->active && ImGui::Selectable(" " ICON_FA_EYE, false, 0, textS)) || (!go->active && ImGui::Selectable(" " ICON_FA_EYE_SLASH, false, 0, textS))) {
 			go->active = !go->active;
+			go->setDirty(true);
+		}
 		ImGui::PopID();
 		if (notAct)
 			ImGui::PopStyleColor();
@@ -401,7 +833,7 @@ namespace wde::scene {
 		ImGui::PushFont(ImGui::GetIO().Fonts->Fonts[1]);
 		ImGui::PushID(static_cast<int>(go->getID()) + 216846352);
 		bool hasNode = false;
-		if (!go->transform->getChildrenIDs().empty() && ImGui::TreeNode("")) {
+		if (!go->transform->getChildren().empty() && ImGui::TreeNode("")) {
 			hasNode = true;
 			// Compute buffer without offset
 			char buf3[4 + go->name.size() + 5];
@@ -428,9 +860,12 @@ namespace wde::scene {
 			ImGui::PopStyleColor();
 
 			// Draw for children
-			for (int childID : go->transform->getChildrenIDs()) {
+			for (auto child : go->transform->getChildren()) {
+				auto childGO = GameObject::find(child);
+				if (childGO == nullptr)
+					continue;
 				ImGui::TableNextRow();
-				drawGUIForGo(_gameObjects[childID].get(), selected);
+				drawGUIForGo(childGO, selected);
 			}
 
 			ImGui::TreePop();
@@ -440,7 +875,7 @@ namespace wde::scene {
 		if (!hasNode) {
 			char buf2[4 + go->name.size() + 5];
 			std::string extraSpace;
-			if (go->transform->getChildrenIDs().empty())
+			if (go->transform->getChildren().empty())
 				extraSpace = "     ";
 
 			if (typeName == "Mesh Entity")
@@ -7,6 +7,10 @@
 #include "../../WdeRender/buffers/Buffer.hpp"
 #include "../../WdeScene/GameObject.hpp"
 #include "TerrainTile.hpp"
+#include "ChunkFile.hpp"
+#include "ChunkComponents.hpp"
+#include "ChunkStaticGeometry.hpp"
+#include "../../WdeCommon/WdeUtils/TransformBatch.hpp"
 
 #include <utility>
 
@@ -25,22 +29,100 @@ namespace wde::scene {
 			};
 
 			// Constructors
-			explicit Chunk(WdeSceneInstance* sceneInstance, glm::ivec2 pos);
-			/** Saves the chunk data to the associated chunk file */
+			/**
+			 * Loads the chunk game objects from its chunk file (can be called from a background thread)
+			 * @param sceneInstance
+			 * @param pos Unique chunk position identifier
+			 * @param loadFile False to create an empty chunk without reading its file
+			 */
+			explicit Chunk(WdeSceneInstance* sceneInstance, glm::ivec2 pos, bool loadFile = true);
+			/** Creates the chunk GPU resources and the remaining game objects modules (must be called from the main thread) */
+			void createResources();
+			/**
+			 * Releases the chunk GPU resources and keeps its game objects, until createResources() is called again
+			 * @return The released buffers, that must be kept alive until the frames using them are done
+			 */
+			std::vector<std::unique_ptr<render::Buffer>> releaseResources();
+			/** Queues the chunk data to be saved to the associated binary chunk file by the scene chunk saver */
 			void save();
+			/** Queues the chunk data to be exported to the associated JSON chunk file (for hand editing) */
+			void exportJSON();
+			/**
+			 * Starts merging the chunk static game objects into baked clusters on a worker thread, replacing the previous baked geometry
+			 * (if enabled in the config). The clusters are uploaded by preTick() once merged.
+			 */
+			void bakeStaticGeometry();
 			~Chunk();
 
 			// Common methods
+			/**
+			 * Deletes the removed game objects, and ticks the main thread only modules if the chunk is simulated this step (main thread)
+			 * @param stepTime Duration of the simulation step (in seconds)
+			 * @param simulate False if the chunk can skip this step (its time is accumulated until its next simulated step)
+			 * @return True if the chunk is simulated this step and simulate() must be called (if it has thread safe modules)
+			 */
+			bool preSimulate(float stepTime, bool simulate);
+			/** Ticks the other modules for the simulation step (can run on a worker thread) */
+			void simulate();
+			/** @return True if the chunk has modules ticked by simulate() */
+			bool hasThreadSafeModules() { return getComponents().hasTickedModules(ModuleTickMode::THREAD_SAFE); }
+			/**
+			 * Deletes the removed game objects and uploads the merged static geometry (main thread)
+			 * @return True if the chunk changed since the last frame and tick() must be called
+			 */
+			bool preTick();
+			/**
+			 * Updates the world matrices of the transforms that have a parent, and of their parents (main thread, before tick()).
+			 * Parents can belong to other chunks, so they cannot be updated while the chunks are ticked in parallel.
+			 */
+			void updateParentedTransforms();
+			/** Updates the game objects transforms (interpolated between the simulation steps) and uploads them (can run on a worker thread) */
 			void tick();
+			/** Creates, grows or releases the game objects buffers if tick() could not upload to them (main thread) */
+			void postTick();
+			/** Creates, grows or releases the game objects buffers if needed and uploads the game objects to them (main thread) */
 			void updateGOBuffers();
+			/** Uploads the camera matrices of this frame (main thread, every frame, even if the chunk was not ticked) */
+			void uploadCameraData(const GPUCameraData& cameraData);
 			void bind(render::CommandBuffer &commandBuffer, resource::Material *material) const;
 			void drawGUI();
 
 
 			// Getters
+			glm::ivec2 getPosition() const { return _pos; }
+			/** @return True if the chunk resources have been created */
+			bool isReady() const { return _isReady; }
+			/** @return True if the chunk GPU resources have been released */
+			bool isDormant() const { return _isDormant; }
+			/** @return True if the chunk data changed since it was last saved */
+			bool isDirty() const { return _isDirty; }
+			/** @return True if the chunk GPU buffers exist (only chunks with mesh renderers have them) */
+			bool hasBuffers() const { return _objectsData != nullptr; }
+			/** @return The size of the chunk GPU buffers (in bytes) */
+			std::size_t getBuffersMemorySize() const;
+			/** @return The number of game objects that fit in the chunk objects buffer */
+			uint32_t getObjectsCapacity() const { return _objectsCapacity; }
+			/** @return The number of bytes written to the chunk GPU buffers during the last buffers update */
+			std::size_t getUploadedBytes() const { return _uploadedBytes; }
+			/** @return The estimated CPU memory used by the chunk game objects (in bytes) */
+			std::size_t getMemorySize() const;
+			/** @return The chunk of the scene containing the given world position */
+			static glm::ivec2 getChunkID(const glm::vec3& position) {
+				double chunkSize = Config::CHUNK_SIZE;
+				return {
+					static_cast<int>(std::floor(position.x / chunkSize + 0.5)),
+					static_cast<int>(std::floor(position.z / chunkSize + 0.5))
+				};
+			}
 			std::vector<std::shared_ptr<GameObject>>& getGameObjects() { return _gameObjects; }
 			std::vector<std::shared_ptr<GameObject>>& getStaticGameObjects()  { return _gameObjectsStatic; }
 			std::vector<std::shared_ptr<GameObject>>& getDynamicGameObjects() { return _gameObjectsDynamic; }
+			/** @return The packed modules lists of the chunk game objects (rebuilt if game objects or modules changed) */
+			const ChunkComponents& getComponents();
+			/** Rebuild the packed modules lists on next access (call after changing the game objects lists directly) */
+			void invalidateComponents() { _componentsDirty = true; }
+			/** @return The baked static geometry of the chunk (its game objects are drawn by its clusters) */
+			const ChunkStaticGeometry& getStaticGeometry() const { return _staticGeometry; }
 			std::pair<VkDescriptorSet, VkDescriptorSetLayout>& getGlobalSet() { return _globalSet; }
 			std::pair<VkDescriptorSet, VkDescriptorSetLayout>& getCullingSet() { return _cullingSet; }
 			std::unique_ptr<render::Buffer>& getCullingSceneBuffer() { return _cullingSceneBuffer; }
@@ -56,12 +138,7 @@ namespace wde::scene {
 			 * @param go
 			 */
 			void addGameObject(const std::shared_ptr<GameObject>& go) {
-				// Add to list
-				_gameObjects.push_back(go);
-				if (go->isStatic())
-					_gameObjectsStatic.push_back(go);
-				else
-					_gameObjectsDynamic.push_back(go);
+				insertGameObject(go);
 			}
 			/**
 			 * Create a new GameObject
@@ -69,12 +146,8 @@ namespace wde::scene {
 			 * @param isStatic True if the game object is a static one (default false)
 			 */
 			std::shared_ptr<GameObject> createGameObject(const std::string& name, bool isStatic = false) {
-				auto goPtr = std::make_shared<GameObject>(Chunk::_gameObjectsIDCurr++, name, isStatic);
-				_gameObjects.push_back(goPtr);
-				if (isStatic)
-					_gameObjectsStatic.push_back(goPtr);
-				else
-					_gameObjectsDynamic.push_back(goPtr);
+				auto goPtr = std::make_shared<GameObject>(name, isStatic);
+				insertGameObject(goPtr);
 				return goPtr;
 			}
 
@@ -85,19 +158,46 @@ namespace wde::scene {
 			void removeGameObject(GameObject* go) {
 				// Remove GameObject
 				_gameObjectsToDelete.push_back(go);
+				_isDirty = true;
 			}
+			/**
+			 * Remove a game object from the chunk lists now, in constant time (the last game objects of the lists take its place)
+			 * @param go Game object of the chunk
+			 * @return The removed game object
+			 */
+			std::shared_ptr<GameObject> detachGameObject(GameObject* go);
+			/** @return The dynamic game objects that left the chunk bounds during the last tick (moved by the scene) */
+			std::vector<GameObject*>& getLeavingGameObjects() { return _leavingGameObjects; }
 			/** Clear the game objects list */
 			void clearGameObjects() {
+				for (auto& go : _gameObjects)
+					go->chunk = nullptr;
 				_gameObjects.clear();
 				_gameObjectsStatic.clear();
 				_gameObjectsDynamic.clear();
+				_isDirty = true;
+				_componentsDirty = true;
 			}
 
 
 		private:
+			/** Module read from the chunk file that will be created on the main thread */
+			struct PendingModule {
+				GameObject* gameObject;
+				std::string name;   // JSON module name (empty for a binary module)
+				std::string config; // JSON module configuration
+				ChunkFile::ModuleEntry binaryModule {}; // Module entry in the binary chunk file
+			};
+
 			// Chunk data
 			WdeSceneInstance* _sceneInstance;
 			glm::ivec2 _pos;
+			/** True if the chunk resources have been created */
+			bool _isReady = false;
+			/** True if the chunk GPU resources have been released by releaseResources() */
+			bool _isDormant = false;
+			/** True if the chunk data changed since it was last saved */
+			bool _isDirty = false;
 
 			// Chunk visualisation
 			static bool _cullingEnabled;
@@ -112,23 +212,108 @@ namespace wde::scene {
 			std::vector<std::shared_ptr<GameObject>> _gameObjectsDynamic {};
 			/** List of all scene game objects to delete on next tick */
 			std::vector<GameObject*> _gameObjectsToDelete {};
+			/** True for the game objects being deleted (index : game object chunk index) */
+			std::vector<bool> _deletedGameObjects {};
+			/** Dynamic game objects that left the chunk bounds during the last tick */
+			std::vector<GameObject*> _leavingGameObjects {};
 			/** Chunk terrain instance */
 			std::unique_ptr<TerrainTile> _terrainTile {};
-
-			// Chunk game objects data
-			/** Last create game object ID */
-			uint32_t _gameObjectsIDCurr = 0;
+			/** Modules that requires the engine to be created (resources, swapchain), created by createResources() */
+			std::vector<PendingModule> _pendingModules {};
+			/** Mapped binary chunk file, kept until the pending modules are created */
+			std::unique_ptr<ChunkFileReader> _chunkFile {};
+			/** Packed modules lists of the game objects */
+			ChunkComponents _components {};
+			/** True if the game objects lists or their modules changed since the components were built (see GameObject::invalidateModules()) */
+			bool _componentsDirty = true;
+			/** Static game objects merged into clusters */
+			ChunkStaticGeometry _staticGeometry {};
+			/** Transforms whose local matrix changed this frame, computed together */
+			TransformBatch _transformBatch {};
+			/** Modules of the transforms in the batch (same order) */
+			std::vector<TransformModule*> _transformBatchModules {};
+			/** Local matrices computed by the batch */
+			std::vector<glm::mat4> _transformBatchMatrices {};
+			/** True if the static transforms must be updated on the next tick (components rebuilt) */
+			bool _staticTransformsOutdated = true;
+			/** Static transforms changes count when they were last updated (see TransformModule::markChanged()) */
+			uint64_t _staticChangesCount = 0;
 
 			// Passes common descriptor sets
 			std::pair<VkDescriptorSet, VkDescriptorSetLayout> _globalSet;
 			std::unique_ptr<render::Buffer> _cameraData;
 			std::unique_ptr<render::Buffer> _objectsData;
+			/** Number of game objects that fit in _objectsData (doubled when the chunk grows past it) */
+			uint32_t _objectsCapacity = 0;
+			/** Data uploaded to each slot of _objectsData (uploaded again only when it changes) */
+			struct UploadedObject {
+				uint64_t transformVersion = 0;
+				glm::vec4 collisionSphere {0.0f};
+			};
+			std::vector<UploadedObject> _uploadedObjects {};
+			/** Number of bytes written to the GPU buffers during the last buffers update */
+			std::size_t _uploadedBytes = 0;
+			/** True if the buffers must be updated by postTick() */
+			bool _buffersUpdatePending = false;
+
+			// Simulation
+			/** Time elapsed since the last simulated step (in seconds) */
+			float _simulationTime = 0.0f;
+			/** Time given to the modules ticked this step (in seconds) */
+			float _tickDeltaTime = 0.0f;
+			/** True if the chunk was simulated during the last step (its transforms are interpolated) */
+			bool _simulatedLastStep = false;
+			/** True if the chunk was simulated since its last tick() */
+			bool _simulatedSinceTick = false;
 
 			// Culling
 			std::unique_ptr<render::Buffer> _cullingSceneBuffer;
 			std::pair<VkDescriptorSet, VkDescriptorSetLayout> _cullingSet;
 			
 			// Helper functions
+			/** Creates the chunk GPU buffers and descriptor sets */
+			void createBuffers();
+			/**
+			 * Creates the chunk objects buffer and the descriptor sets that reference it
+			 * @param capacity Number of game objects that fit in the buffer
+			 */
+			void createObjectsBuffer(uint32_t capacity);
+			/**
+			 * @param count Number of game objects
+			 * @return The smallest objects buffer capacity (power of two times the minimum capacity) that fits the game objects
+			 */
+			static uint32_t getObjectsCapacityFor(std::size_t count);
+			/** @return The released chunk GPU buffers */
+			std::vector<std::unique_ptr<render::Buffer>> releaseBuffers();
+			/** @return True if the game objects buffers must be created, grown or released before the upload */
+			bool needsBuffersUpdate(const ChunkComponents& components) const;
+			/** Uploads the camera and the changed game objects to the buffers */
+			void uploadGOBuffers(const ChunkComponents& components);
+			/** Add a game object at the end of the chunk lists */
+			void insertGameObject(const std::shared_ptr<GameObject>& go);
+			/** Store the indices of the game objects in the chunk lists (after the lists changed) */
+			void reindexGameObjects();
+			/** Marks the game objects to delete of this chunk in _deletedGameObjects */
+			void markDeletedGameObjects();
+			/** Removes the game objects to delete from the chunk lists */
+			void deleteGameObjects();
+			/** Releases the baked static geometry (its game objects are drawn separately until it is baked again) */
+			void releaseStaticGeometry();
+			/** @return True if a game object of the chunk has a mesh renderer (always false in headless mode) */
+			static bool hasRenderableObjects(const ChunkComponents& components);
+			/** @return The path of the chunk files, without extension */
+			std::string getFilePath() const;
+			/**
+			 * Loads the chunk game objects from a binary chunk file
+			 * @param path
+			 */
+			void loadBinary(const std::string& path);
+			/**
+			 * Loads the chunk game objects from a JSON chunk file
+			 * @param path
+			 */
+			void importJSON(const std::string& path);
+
 			/**
 			 * Draw the GUI for a given game object
 			 * @param go GameObject
@@ -0,0 +1,188 @@
+#include "ChunkComponents.hpp"
+#include "../../WdeCommon/WdeUtils/RadixSort.hpp"
+
+#include <type_traits>
+
+namespace wde::scene {
+	namespace {
+		/** Tick registration of a module type */
+		struct ModuleTickRegistration {
+			ModuleTickMode mode = ModuleTickMode::NONE;
+			/** Ticks a list of modules of the type (without virtual calls) */
+			void (*tickAll)(const std::vector<Module*>& modules, float deltaTime) = nullptr;
+		};
+
+		template<typename T>
+		void registerTick(std::array<ModuleTickRegistration, static_cast<std::size_t>(ModuleTypeID::COUNT)>& registrations) {
+			// The tick is called without virtual dispatch : a module type that does not override it would silently tick the empty
+			// Module::tick(), and a module type that overrides it with ModuleTickMode::NONE would never be ticked
+			constexpr bool overridesTick = !std::is_same_v<decltype(&T::tick), void (Module::*)(float)>;
+			static_assert((T::TICK_MODE != ModuleTickMode::NONE) == overridesTick,
+			              "A module must override tick() if and only if its TICK_MODE is not ModuleTickMode::NONE.");
+			registrations[static_cast<std::size_t>(T::TYPE_ID)] = {T::TICK_MODE, [](const std::vector<Module*>& modules, float deltaTime) {
+				for (auto mod : modules) {
+					if (mod->getGameObject().active)
+						static_cast<T*>(mod)->T::tick(deltaTime);
+				}
+			}};
+		}
+
+		/** Tick registration of each module type (index : module type ID) */
+		const auto TICK_REGISTRATIONS = []() {
+			std::array<ModuleTickRegistration, static_cast<std::size_t>(ModuleTypeID::COUNT)> registrations {};
+			registerTick<TransformModule>(registrations);
+			registerTick<MeshRendererModule>(registrations);
+			registerTick<CameraModule>(registrations);
+			registerTick<ControllerModule>(registrations);
+			return registrations;
+		}();
+
+		/** Order in which the module types are ticked */
+		constexpr ModuleTypeID TICK_ORDER[] = {ModuleTypeID::CONTROLLER, ModuleTypeID::CAMERA, ModuleTypeID::TRANSFORM, ModuleTypeID::MESH_RENDERER};
+		static_assert(std::size(TICK_ORDER) == static_cast<std::size_t>(ModuleTypeID::COUNT), "Every module type must have a tick order.");
+	}
+
+	void ChunkComponents::build(const std::vector<std::shared_ptr<GameObject>>& gameObjects) {
+		WDE_PROFILE_FUNCTION();
+		_transforms.clear();
+		_dynamicTransforms.clear();
+		_parentedTransforms.clear();
+		_meshRenderers.clear();
+		_cameras.clear();
+		_controllers.clear();
+		for (auto& modules : _tickedModules)
+			modules.clear();
+		_transforms.reserve(gameObjects.size());
+		std::unordered_map<const MeshRendererModule*, uint32_t> previousSlots = std::move(_objectSlots);
+		_objectSlots = {};
+
+		for (auto& go : gameObjects) {
+			for (auto& mod : go->getModules()) {
+				auto type = static_cast<std::size_t>(mod->getTypeID());
+				if (!go->isStatic() && TICK_REGISTRATIONS[type].mode != ModuleTickMode::NONE)
+					_tickedModules[type].push_back(mod.get());
+
+				switch (mod->getTypeID()) {
+					case ModuleTypeID::TRANSFORM:
+						_transforms.push_back(static_cast<TransformModule*>(mod.get()));
+						if (!go->isStatic())
+							_dynamicTransforms.push_back(static_cast<TransformModule*>(mod.get()));
+						if (static_cast<TransformModule*>(mod.get())->getParent() != nullptr)
+							_parentedTransforms.push_back(static_cast<TransformModule*>(mod.get()));
+						break;
+					case ModuleTypeID::MESH_RENDERER: {
+						auto meshRenderer = static_cast<MeshRendererModule*>(mod.get());
+						auto it = previousSlots.find(meshRenderer);
+						uint32_t slot;
+						if (it != previousSlots.end()) {
+							slot = it->second;
+							previousSlots.erase(it);
+						}
+						else
+							slot = UINT32_MAX;
+						_objectSlots.emplace(meshRenderer, slot);
+						_meshRenderers.push_back({go.get(), go->transform, meshRenderer, slot, 0});
+						break;
+					}
+					case ModuleTypeID::CAMERA:
+						_cameras.push_back(static_cast<CameraModule*>(mod.get()));
+						break;
+					case ModuleTypeID::CONTROLLER:
+						_controllers.push_back(static_cast<ControllerModule*>(mod.get()));
+						break;
+					default:
+						break;
+				}
+			}
+		}
+
+		// Release the slots of the removed mesh renderers
+		for (auto& slot : previousSlots)
+			_freeObjectSlots.push_back(slot.second);
+		if (_objectSlots.empty() && _allocatedSlotsCount == 0) {
+			_freeObjectSlots.clear();
+			_objectSlotsCount = 0;
+		}
+
+		// Allocate the slots of the new mesh renderers
+		for (auto& entry : _meshRenderers) {
+			if (entry.objectSlot != UINT32_MAX)
+				continue;
+			if (!_freeObjectSlots.empty()) {
+				entry.objectSlot = _freeObjectSlots.back();
+				_freeObjectSlots.pop_back();
+			}
+			else
+				entry.objectSlot = _objectSlotsCount++;
+			_objectSlots.at(entry.meshRenderer) = entry.objectSlot;
+		}
+
+		// Drawing order
+		for (auto& entry : _meshRenderers)
+			entry.renderKey = getRenderKey(entry);
+		radixSort(_meshRenderers, _sortScratch, [](const MeshRendererEntry& entry) { return entry.renderKey; });
+	}
+
+	void ChunkComponents::tickModules(ModuleTickMode mode, float deltaTime) const {
+		WDE_PROFILE_FUNCTION();
+		for (auto type : TICK_ORDER) {
+			auto& registration = TICK_REGISTRATIONS[static_cast<std::size_t>(type)];
+			auto& modules = _tickedModules[static_cast<std::size_t>(type)];
+			if (registration.mode == mode && !modules.empty())
+				registration.tickAll(modules, deltaTime);
+		}
+	}
+
+	bool ChunkComponents::hasTickedModules(ModuleTickMode mode) const {
+		for (auto type : TICK_ORDER) {
+			if (TICK_REGISTRATIONS[static_cast<std::size_t>(type)].mode == mode && !_tickedModules[static_cast<std::size_t>(type)].empty())
+				return true;
+		}
+		return false;
+	}
+
+	void ChunkComponents::updateRenderOrder() {
+		WDE_PROFILE_FUNCTION();
+		bool changed = false;
+		for (auto& entry : _meshRenderers) {
+			uint64_t key = getRenderKey(entry);
+			if (key != entry.renderKey) {
+				entry.renderKey = key;
+				changed = true;
+			}
+		}
+		if (changed)
+			radixSort(_meshRenderers, _sortScratch, [](const MeshRendererEntry& entry) { return entry.renderKey; });
+	}
+
+	uint64_t ChunkComponents::getRenderKey(const MeshRendererEntry& entry) {
+		auto material = entry.meshRenderer->getMaterial();
+		auto mesh = entry.meshRenderer->getMesh();
+		if (!entry.gameObject->active || material == nullptr || mesh == nullptr)
+			return UINT64_MAX;
+
+		auto stage = material->getRenderStage();
+		return (static_cast<uint64_t>(stage.first & 0xF) << 60)
+			| (static_cast<uint64_t>(stage.second & 0xF) << 56)
+			| (static_cast<uint64_t>(material->getID() & 0xFFFFFF) << 32)
+			| (static_cast<uint64_t>(mesh->getID() & 0xFFFFFF) << 8);
+	}
+
+	uint32_t ChunkComponents::allocateObjectSlot() {
+		_allocatedSlotsCount++;
+		if (_freeObjectSlots.empty())
+			return _objectSlotsCount++;
+		uint32_t slot = _freeObjectSlots.back();
+		_freeObjectSlots.pop_back();
+		return slot;
+	}
+
+	void ChunkComponents::releaseObjectSlot(uint32_t slot) {
+		_allocatedSlotsCount--;
+		_freeObjectSlots.push_back(slot);
+		if (_objectSlots.empty() && _allocatedSlotsCount == 0) {
+			_freeObjectSlots.clear();
+			_objectSlotsCount = 0;
+		}
+	}
+}
@@ -0,0 +1,100 @@
+#pragma once
+
+#include <array>
+
+#include "../../../wde.hpp"
+#include "../GameObject.hpp"
+#include "../modules/MeshRendererModule.hpp"
+#include "../modules/CameraModule.hpp"
+#include "../modules/ControllerModule.hpp"
+
+namespace wde::scene {
+	/**
+	 * Packed lists of the modules of each type of a chunk game objects (in game objects order), that can be iterated
+	 * without walking the modules of every game object. Modules are still owned by their game object.
+	 * Each mesh renderer also keeps a stable slot in the chunk objects buffer across rebuilds.
+	 * Mesh renderers are kept sorted by render key, so that the game objects sharing a material and a mesh are drawn
+	 * in the same batches.
+	 */
+	class ChunkComponents {
+		public:
+			/** Rendered game object data */
+			struct MeshRendererEntry {
+				GameObject* gameObject;
+				TransformModule* transform;
+				MeshRendererModule* meshRenderer;
+				/** Index of the game object data in the chunk objects buffer (kept until the mesh renderer leaves the chunk) */
+				uint32_t objectSlot;
+				/** Drawing order key (see getRenderKey()) */
+				uint64_t renderKey;
+			};
+
+			/**
+			 * Rebuild the lists from a list of game objects
+			 * @param gameObjects
+			 */
+			void build(const std::vector<std::shared_ptr<GameObject>>& gameObjects);
+			/** @return A new objects buffer slot that is not used by a mesh renderer (for objects drawn by the chunk itself) */
+			uint32_t allocateObjectSlot();
+			/**
+			 * Releases a slot given by allocateObjectSlot()
+			 * @param slot
+			 */
+			void releaseObjectSlot(uint32_t slot);
+			/** Sorts the mesh renderers again if the render key of one of them changed (material or mesh changed) */
+			void updateRenderOrder();
+			/**
+			 * Drawing order key of a mesh renderer, from the most to the least significant bits :
+			 * render pass (4 bits), render subpass (4 bits), material and pipeline (24 bits), mesh (24 bits), depth bucket (8 bits).
+			 * Each material owns its pipeline, so the material ID also orders the pipelines. The depth bucket is reserved (0).
+			 * Mesh renderers that are not drawn (inactive, or without material or mesh) have the highest key.
+			 * @param entry
+			 * @return The render key of the mesh renderer
+			 */
+			static uint64_t getRenderKey(const MeshRendererEntry& entry);
+
+			// Getters
+			const std::vector<TransformModule*>& getTransforms() const { return _transforms; }
+			/** @return The transforms of the dynamic game objects */
+			const std::vector<TransformModule*>& getDynamicTransforms() const { return _dynamicTransforms; }
+			/** @return The transforms that have a parent (their parent can belong to another chunk) */
+			const std::vector<TransformModule*>& getParentedTransforms() const { return _parentedTransforms; }
+			const std::vector<MeshRendererEntry>& getMeshRenderers() const { return _meshRenderers; }
+			const std::vector<CameraModule*>& getCameras() const { return _cameras; }
+			const std::vector<ControllerModule*>& getControllers() const { return _controllers; }
+			/**
+			 * Ticks the modules of the active dynamic game objects of the given tick mode, one module type after the other
+			 * (controllers, then cameras). Module types that do not tick are never visited.
+			 * @param mode ModuleTickMode::MAIN_THREAD or ModuleTickMode::THREAD_SAFE
+			 * @param deltaTime Time since the last tick of the modules (in seconds)
+			 */
+			void tickModules(ModuleTickMode mode, float deltaTime) const;
+			/** @return True if tickModules() has modules to tick in the given tick mode */
+			bool hasTickedModules(ModuleTickMode mode) const;
+			/** @return The number of objects buffer slots in use or free (every object slot is lower) */
+			uint32_t getObjectSlotsCount() const { return _objectSlotsCount; }
+
+
+		private:
+			std::vector<TransformModule*> _transforms {};
+			std::vector<TransformModule*> _dynamicTransforms {};
+			std::vector<TransformModule*> _parentedTransforms {};
+			std::vector<MeshRendererEntry> _meshRenderers {};
+			std::vector<CameraModule*> _cameras {};
+			std::vector<ControllerModule*> _controllers {};
+			/** Modules of the dynamic game objects that tick (index : module type ID) */
+			std::array<std::vector<Module*>, static_cast<std::size_t>(ModuleTypeID::COUNT)> _tickedModules {};
+			/** Sorting storage of the mesh renderers */
+			std::vector<MeshRendererEntry> _sortScratch {};
+
+			// Objects buffer slots
+			/** Slot of each mesh renderer of the chunk (mesh renderer - slot) */
+			std::unordered_map<const MeshRendererModule*, uint32_t> _objectSlots {};
+			/** Released slots, reused before new ones */
+			std::vector<uint32_t> _freeObjectSlots {};
+			/** Number of allocated slots (used and free) */
+			uint32_t _objectSlotsCount = 0;
+			/** Number of slots given by allocateObjectSlot() */
+			uint32_t _allocatedSlotsCount = 0;
+	};
+}
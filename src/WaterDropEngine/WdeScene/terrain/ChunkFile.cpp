@@ -0,0 +1,73 @@
+#include "ChunkFile.hpp"
+
+namespace wde::scene {
+	// Writer
+	void ChunkFileWriter::addObject(const std::string& name, int32_t parentIndex, bool active, bool isStatic) {
+		ChunkFile::ObjectEntry obj {};
+		obj.name = addString(name);
+		obj.parentIndex = parentIndex;
+		obj.flags = (active ? ChunkFile::ACTIVE : 0) | (isStatic ? ChunkFile::STATIC : 0);
+		obj.firstModule = static_cast<uint32_t>(_modules.size());
+		obj.modulesCount = 0;
+		_objects.push_back(obj);
+	}
+
+	ChunkFile::StringRef ChunkFileWriter::addString(const std::string& str) {
+		ChunkFile::StringRef ref {static_cast<uint32_t>(_strings.size()), static_cast<uint32_t>(str.size())};
+		_strings.insert(_strings.end(), str.begin(), str.end());
+		return ref;
+	}
+
+	std::string ChunkFileWriter::getData() const {
+		WDE_PROFILE_FUNCTION();
+
+		// Compute sections layout
+		ChunkFile::Header header {};
+		header.magic = ChunkFile::MAGIC;
+		header.version = ChunkFile::VERSION;
+		header.chunkX = _chunkID.x;
+		header.chunkY = _chunkID.y;
+		header.objectsCount = static_cast<uint32_t>(_objects.size());
+		header.modulesCount = static_cast<uint32_t>(_modules.size());
+		header.objectsOffset = sizeof(ChunkFile::Header);
+		header.modulesOffset = header.objectsOffset + _objects.size() * sizeof(ChunkFile::ObjectEntry);
+		header.blobsOffset = header.modulesOffset + _modules.size() * sizeof(ChunkFile::ModuleEntry);
+		header.blobsSize = _blobs.size();
+		header.stringsOffset = header.blobsOffset + header.blobsSize;
+		header.stringsSize = _strings.size();
+
+		// Write sections
+		std::string data {};
+		data.reserve(header.stringsOffset + header.stringsSize);
+		data.append(reinterpret_cast<const char*>(&header), sizeof(ChunkFile::Header));
+		data.append(reinterpret_cast<const char*>(_objects.data()), _objects.size() * sizeof(ChunkFile::ObjectEntry));
+		data.append(reinterpret_cast<const char*>(_modules.data()), _modules.size() * sizeof(ChunkFile::ModuleEntry));
+		data.append(_blobs.data(), _blobs.size());
+		data.append(_strings.data(), _strings.size());
+		return data;
+	}
+
+
+
+	// Reader
+	ChunkFileReader::ChunkFileReader(const std::string& path) : _file(path) {
+		WDE_PROFILE_FUNCTION();
+
+		// Check header
+		if (_file.getSize() < sizeof(ChunkFile::Header))
+			throw WdeException(LogChannel::SCENE, "Chunk file '" + path + "' is too small.");
+		_header = read<ChunkFile::Header>(0);
+		if (_header.magic != ChunkFile::MAGIC)
+			throw WdeException(LogChannel::SCENE, "File '" + path + "' is not a binary chunk file.");
+		if (_header.version != ChunkFile::VERSION)
+			throw WdeException(LogChannel::SCENE, "Chunk file '" + path + "' has unsupported version " + std::to_string(_header.version) + ".");
+
+		// Check sections bounds
+		uint64_t size = _file.getSize();
+		if (_header.objectsOffset + uint64_t(_header.objectsCount) * sizeof(ChunkFile::ObjectEntry) > size
+		    || _header.modulesOffset + uint64_t(_header.modulesCount) * sizeof(ChunkFile::ModuleEntry) > size
+		    || _header.blobsOffset + _header.blobsSize > size
+		    || _header.stringsOffset + _header.stringsSize > size)
+			throw WdeException(LogChannel::SCENE, "Chunk file '" + path + "' is corrupted.");
+	}
+}
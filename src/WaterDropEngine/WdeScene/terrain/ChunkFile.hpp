@@ -0,0 +1,193 @@
+#pragma once
+
+#include <cstring>
+#include <string_view>
+
+#include "../../../wde.hpp"
+#include "../../WdeCommon/WdeFiles/MappedFile.hpp"
+
+namespace wde::scene {
+	/**
+	 * Binary chunk file format description.
+	 * Layout : Header | Objects table | Modules table | Modules blobs | Strings table.
+	 * Every offset is in bytes, relative to the beginning of the file (strings and blobs offsets are relative to their section).
+	 */
+	namespace ChunkFile {
+		/** Chunk file magic number ("WDEC") */
+		constexpr uint32_t MAGIC = 0x43454457;
+		/** Current version of the binary chunk format */
+		constexpr uint32_t VERSION = 1;
+		/** Binary chunk file extension */
+		const std::string EXTENSION = ".wdechunk";
+
+		/** Type of a serialized module */
+		enum class ModuleType : uint32_t {
+			TRANSFORM     = 0,
+			MESH_RENDERER = 1,
+			CAMERA        = 2,
+			CONTROLLER    = 3
+		};
+
+#pragma pack(push, 1)
+		/** Reference to a string of the strings table */
+		struct StringRef {
+			uint32_t offset;
+			uint32_t size;
+		};
+
+		/** File header */
+		struct Header {
+			uint32_t magic;
+			uint32_t version;
+			int32_t chunkX;
+			int32_t chunkY;
+			uint32_t objectsCount;
+			uint32_t modulesCount;
+			uint64_t objectsOffset;
+			uint64_t modulesOffset;
+			uint64_t blobsOffset;
+			uint64_t blobsSize;
+			uint64_t stringsOffset;
+			uint64_t stringsSize;
+		};
+
+		/** Game object entry of the objects table */
+		struct ObjectEntry {
+			StringRef name;
+			int32_t parentIndex;   // Index of the parent object in the objects table (-1 if none)
+			uint32_t flags;        // See ObjectFlags
+			uint32_t firstModule;  // Index of the first object module in the modules table
+			uint32_t modulesCount; // Number of modules of the object
+		};
+
+		/** Module entry of the modules table */
+		struct ModuleEntry {
+			ModuleType type;
+			uint32_t blobOffset;
+			uint32_t blobSize;
+		};
+#pragma pack(pop)
+
+		/** Game object entry flags */
+		enum ObjectFlags : uint32_t {
+			ACTIVE = 1 << 0,
+			STATIC = 1 << 1
+		};
+	}
+
+
+	/**
+	 * Creates a binary chunk file
+	 */
+	class ChunkFileWriter {
+		public:
+			explicit ChunkFileWriter(glm::ivec2 chunkID) : _chunkID(chunkID) {}
+
+			/**
+			 * Add a new game object to the file. The following addModule() calls will add modules to this object.
+			 * @param name Name of the game object
+			 * @param parentIndex Index of the parent object (-1 if none)
+			 * @param active
+			 * @param isStatic
+			 */
+			void addObject(const std::string& name, int32_t parentIndex, bool active, bool isStatic);
+
+			/**
+			 * Add a module to the last added game object
+			 * @tparam T Module binary data type (must be trivially copyable)
+			 * @param type Type of the module
+			 * @param data Module binary data
+			 */
+			template<typename T>
+			void addModule(ChunkFile::ModuleType type, const T& data) {
+				static_assert(std::is_trivially_copyable_v<T>, "Chunk file modules data must be trivially copyable.");
+				if (_objects.empty())
+					throw WdeException(LogChannel::SCENE, "Trying to add a module to a chunk file without game object.");
+
+				_modules.push_back({type, static_cast<uint32_t>(_blobs.size()), static_cast<uint32_t>(sizeof(T))});
+				auto bytes = reinterpret_cast<const char*>(&data);
+				_blobs.insert(_blobs.end(), bytes, bytes + sizeof(T));
+				_objects.back().modulesCount++;
+			}
+
+			/**
+			 * Add a string to the strings table
+			 * @param str
+			 * @return The reference to the string
+			 */
+			ChunkFile::StringRef addString(const std::string& str);
+
+			/** @return The content of the chunk file */
+			std::string getData() const;
+
+
+		private:
+			glm::ivec2 _chunkID;
+			std::vector<ChunkFile::ObjectEntry> _objects {};
+			std::vector<ChunkFile::ModuleEntry> _modules {};
+			std::vector<char> _blobs {};
+			std::vector<char> _strings {};
+	};
+
+
+	/**
+	 * Reads a memory mapped binary chunk file, without copying its content
+	 */
+	class ChunkFileReader : public NonCopyable {
+		public:
+			/**
+			 * Map and validate a chunk file
+			 * @param path Path of the file
+			 */
+			explicit ChunkFileReader(const std::string& path);
+
+
+			// Getters
+			const ChunkFile::Header& getHeader() const { return _header; }
+			ChunkFile::ObjectEntry getObject(uint32_t index) const {
+				if (index >= _header.objectsCount)
+					throw WdeException(LogChannel::SCENE, "Chunk file object index out of bounds.");
+				return read<ChunkFile::ObjectEntry>(_header.objectsOffset + uint64_t(index) * sizeof(ChunkFile::ObjectEntry));
+			}
+			ChunkFile::ModuleEntry getModule(uint32_t index) const {
+				if (index >= _header.modulesCount)
+					throw WdeException(LogChannel::SCENE, "Chunk file module index out of bounds.");
+				return read<ChunkFile::ModuleEntry>(_header.modulesOffset + uint64_t(index) * sizeof(ChunkFile::ModuleEntry));
+			}
+
+			/**
+			 * @param ref Reference to the string
+			 * @return A view to the string in the mapped file
+			 */
+			std::string_view getString(ChunkFile::StringRef ref) const {
+				if (uint64_t(ref.offset) + ref.size > _header.stringsSize)
+					throw WdeException(LogChannel::SCENE, "Chunk file string out of bounds.");
+				return {_file.getData() + _header.stringsOffset + ref.offset, ref.size};
+			}
+
+			/**
+			 * @tparam T Module binary data type
+			 * @param module
+			 * @return The module binary data
+			 */
+			template<typename T>
+			T getBlob(const ChunkFile::ModuleEntry& module) const {
+				if (module.blobSize != sizeof(T) || uint64_t(module.blobOffset) + module.blobSize > _header.blobsSize)
+					throw WdeException(LogChannel::SCENE, "Chunk file module data is corrupted.");
+				return read<T>(_header.blobsOffset + module.blobOffset);
+			}
+
+
+		private:
+			MappedFile _file;
+			ChunkFile::Header _header {};
+
+			/** Read a value at a given offset of the file (the file content may not be aligned) */
+			template<typename T>
+			T read(uint64_t offset) const {
+				T value;
+				std::memcpy(&value, _file.getData() + offset, sizeof(T));
+				return value;
+			}
+	};
+}
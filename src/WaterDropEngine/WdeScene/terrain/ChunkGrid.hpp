@@ -0,0 +1,227 @@
+#pragma once
+
+#include <optional>
+
+#include "../../../wde.hpp"
+
+namespace wde::scene {
+	/**
+	 * Fixed-size toroidal grid of chunk values centred on the camera chunk.
+	 * A value is stored in the slot given by its position modulo the grid width, so the values around the center are
+	 * accessed without hashing and iterated contiguously. Values outside of the grid window (or sharing their slot with
+	 * a value of the window) are kept in an overflow map.
+	 */
+	template<typename T>
+	class ChunkGrid {
+		public:
+			/** Stored pair (same as an unordered_map value) */
+			using value_type = std::pair<const glm::ivec2, T>;
+
+			/** Iterates through the grid slots, then through the overflow map */
+			class Iterator {
+				public:
+					Iterator(ChunkGrid* grid, std::size_t slot, typename std::unordered_map<glm::ivec2, T>::iterator overflowIt)
+							: _grid(grid), _slot(slot), _overflowIt(overflowIt) { skipEmptySlots(); }
+
+					value_type& operator*() const { return _slot < _grid->_slots.size() ? *_grid->_slots[_slot] : *_overflowIt; }
+					value_type* operator->() const { return &**this; }
+					Iterator& operator++() {
+						if (_slot < _grid->_slots.size()) {
+							_slot++;
+							skipEmptySlots();
+						}
+						else
+							_overflowIt++;
+						return *this;
+					}
+					bool operator==(const Iterator& other) const { return _slot == other._slot && _overflowIt == other._overflowIt; }
+					bool operator!=(const Iterator& other) const { return !(*this == other); }
+
+				private:
+					ChunkGrid* _grid;
+					std::size_t _slot;
+					typename std::unordered_map<glm::ivec2, T>::iterator _overflowIt;
+
+					void skipEmptySlots() {
+						while (_slot < _grid->_slots.size() && !_grid->_slots[_slot].has_value())
+							_slot++;
+					}
+			};
+
+
+			// Constructors
+			/**
+			 * Creates an empty grid
+			 * @param radius Radius of the grid window around its center (in chunks)
+			 */
+			explicit ChunkGrid(int radius) { resize(radius); }
+
+
+			// Core functions
+			/**
+			 * @param pos Chunk position
+			 * @return A pointer to the value at the given position (nullptr if none)
+			 */
+			T* find(glm::ivec2 pos) {
+				auto& slot = _slots[getSlot(pos)];
+				if (slot.has_value() && slot->first == pos)
+					return &slot->second;
+				if (_overflow.empty())
+					return nullptr;
+				auto it = _overflow.find(pos);
+				return it == _overflow.end() ? nullptr : &it->second;
+			}
+			/**
+			 * @param pos Chunk position
+			 * @return True if the grid has a value at the given position
+			 */
+			bool contains(glm::ivec2 pos) { return find(pos) != nullptr; }
+			/**
+			 * @param pos Chunk position
+			 * @return The value at the given position (throws if none)
+			 */
+			T& at(glm::ivec2 pos) {
+				T* value = find(pos);
+				if (value == nullptr)
+					throw WdeException(LogChannel::SCENE, "Trying to access a chunk that is not in the chunks grid.");
+				return *value;
+			}
+
+			/**
+			 * Adds a value to the grid if there is none at its position
+			 * @param pos Chunk position
+			 * @param value
+			 */
+			void emplace(glm::ivec2 pos, T value) {
+				if (contains(pos))
+					return;
+				_size++;
+
+				// Free slot
+				auto& slot = _slots[getSlot(pos)];
+				if (!slot.has_value()) {
+					slot.emplace(pos, std::move(value));
+					return;
+				}
+
+				// Slot used by a value inside the window, the new value is outside of it
+				if (isInWindow(slot->first)) {
+					_overflow.emplace(pos, std::move(value));
+					return;
+				}
+
+				// Slot used by a value outside of the window, move it to the overflow map
+				_overflow.emplace(slot->first, std::move(slot->second));
+				slot.emplace(pos, std::move(value));
+			}
+			/**
+			 * Removes the value at a given position (if any)
+			 * @param pos Chunk position
+			 */
+			void erase(glm::ivec2 pos) {
+				auto& slot = _slots[getSlot(pos)];
+				if (slot.has_value() && slot->first == pos) {
+					slot.reset();
+					_size--;
+				}
+				else
+					_size -= _overflow.erase(pos);
+			}
+			/** Removes every value */
+			void clear() {
+				for (auto& slot : _slots)
+					slot.reset();
+				_overflow.clear();
+				_size = 0;
+			}
+
+			/**
+			 * Moves the grid window, and moves back the overflowing values that are now inside of it to their slot
+			 * @param center New window center
+			 */
+			void setCenter(glm::ivec2 center) {
+				if (center == _center)
+					return;
+				WDE_PROFILE_FUNCTION();
+				_center = center;
+
+				auto it = _overflow.begin();
+				while (it != _overflow.end()) {
+					auto& slot = _slots[getSlot(it->first)];
+					if (!isInWindow(it->first) || (slot.has_value() && isInWindow(slot->first))) {
+						it++;
+						continue;
+					}
+
+					// Swap with the slot value outside of the window
+					if (slot.has_value()) {
+						std::optional<value_type> previous {};
+						previous.emplace(slot->first, std::move(slot->second));
+						slot.emplace(it->first, std::move(it->second));
+						_overflow.erase(it);
+						_overflow.emplace(previous->first, std::move(previous->second));
+						it = _overflow.begin(); // Insertion may invalidate iterators
+					}
+					else {
+						slot.emplace(it->first, std::move(it->second));
+						it = _overflow.erase(it);
+					}
+				}
+			}
+			/**
+			 * Changes the window radius of the grid (values are kept)
+			 * @param radius Radius of the grid window around its center (in chunks)
+			 */
+			void resize(int radius) {
+				WDE_PROFILE_FUNCTION();
+				std::vector<std::optional<value_type>> slots = std::move(_slots);
+				std::unordered_map<glm::ivec2, T> overflow = std::move(_overflow);
+
+				_radius = radius;
+				_width = 2 * radius + 1;
+				_slots = std::vector<std::optional<value_type>>(static_cast<std::size_t>(_width * _width));
+				_overflow = {};
+				_size = 0;
+				for (auto& slot : slots)
+					if (slot.has_value())
+						emplace(slot->first, std::move(slot->second));
+				for (auto& value : overflow)
+					emplace(value.first, std::move(value.second));
+			}
+
+
+			// Getters
+			Iterator begin() { return Iterator(this, 0, _overflow.begin()); }
+			Iterator end() { return Iterator(this, _slots.size(), _overflow.end()); }
+			std::size_t size() const { return _size; }
+			bool empty() const { return _size == 0; }
+			int getRadius() const { return _radius; }
+			glm::ivec2 getCenter() const { return _center; }
+			/** @return Number of values stored outside of their grid slot */
+			std::size_t getOverflowCount() const { return _overflow.size(); }
+
+
+		private:
+			/** Radius of the window around its center (in chunks) */
+			int _radius = 0;
+			/** Width of the grid (in chunks) */
+			int _width = 1;
+			/** Center of the grid window */
+			glm::ivec2 _center {0, 0};
+			/** Grid slots, indexed by position modulo the grid width */
+			std::vector<std::optional<value_type>> _slots {};
+			/** Values that are not stored in their slot (pos - value) */
+			std::unordered_map<glm::ivec2, T> _overflow {};
+			/** Number of values in the grid */
+			std::size_t _size = 0;
+
+			std::size_t getSlot(glm::ivec2 pos) const {
+				int x = ((pos.x % _width) + _width) % _width;
+				int y = ((pos.y % _width) + _width) % _width;
+				return static_cast<std::size_t>(x + y * _width);
+			}
+			bool isInWindow(glm::ivec2 pos) const {
+				return std::abs(pos.x - _center.x) <= _radius && std::abs(pos.y - _center.y) <= _radius;
+			}
+	};
+}
@@ -0,0 +1,108 @@
+#include "ChunkSaver.hpp"
+
+namespace wde::scene {
+	ChunkSaver::ChunkSaver() {
+		_thread = std::thread(&ChunkSaver::run, this);
+	}
+
+	ChunkSaver::~ChunkSaver() {
+		WDE_PROFILE_FUNCTION();
+		{
+			std::lock_guard<std::mutex> lock(_mutex);
+			_stop = true;
+		}
+		_queuedCondition.notify_one();
+		_thread.join();
+	}
+
+
+	void ChunkSaver::write(const std::string& path, std::string data) {
+		{
+			std::lock_guard<std::mutex> lock(_mutex);
+			if (!_queuedData.contains(path))
+				_queue.push_back(path);
+			_queuedData[path] = std::move(data);
+		}
+		_queuedCondition.notify_one();
+	}
+
+	void ChunkSaver::waitForFile(const std::string& path) {
+		std::unique_lock<std::mutex> lock(_mutex);
+		_writtenCondition.wait(lock, [this, &path]() {
+			return !_queuedData.contains(path) && _writingPath != path;
+		});
+	}
+
+	void ChunkSaver::flush() {
+		WDE_PROFILE_FUNCTION();
+		std::unique_lock<std::mutex> lock(_mutex);
+		_writtenCondition.wait(lock, [this]() {
+			return _queue.empty() && _writingPath.empty();
+		});
+	}
+
+	std::size_t ChunkSaver::getQueuedCount() {
+		std::lock_guard<std::mutex> lock(_mutex);
+		return _queue.size();
+	}
+
+
+	void ChunkSaver::run() {
+		while (true) {
+			// Wait for a file to write
+			std::string path;
+			std::string data;
+			{
+				std::unique_lock<std::mutex> lock(_mutex);
+				_queuedCondition.wait(lock, [this]() { return _stop || !_queue.empty(); });
+				if (_queue.empty())
+					return;
+
+				path = _queue.front();
+				_queue.pop_front();
+				data = std::move(_queuedData.at(path));
+				_queuedData.erase(path);
+				_writingPath = path;
+			}
+
+			// Write file
+			writeFile(path, data);
+			{
+				std::lock_guard<std::mutex> lock(_mutex);
+				_writingPath.clear();
+			}
+			_writtenCondition.notify_all();
+		}
+	}
+
+	void ChunkSaver::writeFile(const std::string& path, const std::string& data) {
+		WDE_PROFILE_FUNCTION();
+
+		// Make sure the directory is created
+		std::error_code error;
+		auto directory = std::filesystem::path(path).parent_path();
+		if (!directory.empty())
+			std::filesystem::create_directories(directory, error);
+		if (error) {
+			logger::log(LogLevel::ERR, LogChannel::SCENE) << "Failed to create directory '" << directory.string() << "' : " << error.message() << "." << logger::endl;
+			return;
+		}
+
+		// Write to temporary file
+		std::string tmpPath = path + ".tmp";
+		{
+			std::ofstream outputData {tmpPath, std::ofstream::out | std::ofstream::binary | std::ofstream::trunc};
+			outputData.write(data.data(), static_cast<std::streamsize>(data.size()));
+			outputData.close();
+			if (outputData.fail()) {
+				logger::log(LogLevel::ERR, LogChannel::SCENE) << "Failed to write chunk file '" << tmpPath << "'." << logger::endl;
+				return;
+			}
+		}
+
+		// Replace file
+		std::filesystem::rename(tmpPath, path, error);
+		if (error)
+			logger::log(LogLevel::ERR, LogChannel::SCENE) << "Failed to replace chunk file '" << path << "' : " << error.message() << "." << logger::endl;
+	}
+}
@@ -0,0 +1,68 @@
+#pragma once
+
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <deque>
+#include <filesystem>
+
+#include "../../../wde.hpp"
+
+namespace wde::scene {
+	/**
+	 * Writes the chunk files on a background thread.
+	 * Files are written to a temporary file that is then renamed, so a chunk file is never partially written.
+	 */
+	class ChunkSaver : public NonCopyable {
+		public:
+			ChunkSaver();
+			/** Writes the remaining queued files and stops the writing thread */
+			~ChunkSaver() override;
+
+			/**
+			 * Queue a file to be written by the background thread (replaces the queued content of the same file)
+			 * @param path Path of the file
+			 * @param data Content of the file
+			 */
+			void write(const std::string& path, std::string data);
+			/**
+			 * Wait until the given file has no queued or ongoing write
+			 * @param path Path of the file
+			 */
+			void waitForFile(const std::string& path);
+			/** Wait until every queued file is written */
+			void flush();
+
+			/** @return The number of files waiting to be written */
+			std::size_t getQueuedCount();
+
+
+		private:
+			/** Writing thread */
+			std::thread _thread;
+			/** Protects the queue and the writing state */
+			std::mutex _mutex;
+			/** Notified when a file is queued or when the thread should stop */
+			std::condition_variable _queuedCondition;
+			/** Notified when a file has been written */
+			std::condition_variable _writtenCondition;
+
+			/** Files waiting to be written, in queuing order (path) */
+			std::deque<std::string> _queue {};
+			/** Content of the files waiting to be written (path - data) */
+			std::unordered_map<std::string, std::string> _queuedData {};
+			/** Path of the file being written (empty if none) */
+			std::string _writingPath {};
+			/** True if the thread should stop once the queue is empty */
+			bool _stop = false;
+
+			/** Writing thread loop */
+			void run();
+			/**
+			 * Write a file to a temporary file and rename it (its directory is created if needed)
+			 * @param path Path of the file
+			 * @param data Content of the file
+			 */
+			static void writeFile(const std::string& path, const std::string& data);
+	};
+}
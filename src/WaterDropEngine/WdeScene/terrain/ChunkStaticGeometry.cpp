@@ -0,0 +1,184 @@
+#include "ChunkStaticGeometry.hpp"
+
+#include <map>
+#include <tuple>
+#include <limits>
+
+namespace wde::scene {
+	ChunkStaticGeometry::~ChunkStaticGeometry() {
+		cancelBake();
+	}
+
+	void ChunkStaticGeometry::startBake(const ChunkComponents& components, glm::ivec2 chunkPos) {
+		WDE_PROFILE_FUNCTION();
+		cancelBake();
+
+		// Copy the static game objects data used by the worker thread (their modules may change while it merges them)
+		std::vector<BakeObject> objects {};
+		for (auto& entry : components.getMeshRenderers()) {
+			auto mesh = entry.meshRenderer->getMesh();
+			auto material = entry.meshRenderer->getMaterial();
+			if (!entry.gameObject->isStatic() || !entry.gameObject->active || mesh == nullptr || material == nullptr
+					|| mesh->getIndexCount() == 0 || mesh->getGeometrySource() == nullptr)
+				continue;
+			objects.push_back({mesh->getGeometrySource(), material, material->getID(), entry.transform->getTransform(), entry.objectSlot,
+							   {entry.meshRenderer, entry.transform->getTransformVersion(), mesh, material}});
+		}
+		if (objects.empty())
+			return;
+
+		// Merge them on a worker thread
+		_bakeCancelled = std::make_shared<std::atomic<bool>>(false);
+		_bake = std::async(std::launch::async, [objects = std::move(objects), chunkPos, cancelled = _bakeCancelled]() {
+			return merge(objects, chunkPos, *cancelled);
+		});
+	}
+
+	bool ChunkStaticGeometry::finishBake(ChunkComponents& components) {
+		if (!_bake.valid() || _bake.wait_for(std::chrono::seconds(0)) != std::future_status::ready)
+			return false;
+		WDE_PROFILE_FUNCTION();
+		auto mergedClusters = _bake.get();
+		_bakeCancelled.reset();
+
+		// Remember the merged game objects
+		for (auto& merged : mergedClusters) {
+			for (auto& source : merged.sources) {
+				if (_sources.size() <= source.first)
+					_sources.resize(source.first + 1);
+				_sources[source.first] = source.second;
+				_bakedObjectsCount++;
+			}
+		}
+
+		// Game objects changed during the merge (they are drawn separately until the chunk is baked again)
+		if (isOutdated(components)) {
+			_sources.clear();
+			_bakedObjectsCount = 0;
+			return false;
+		}
+
+		// Upload the clusters
+		for (auto& merged : mergedClusters) {
+			Cluster cluster {};
+			cluster.material = merged.material;
+			cluster.mesh = std::make_unique<resource::Mesh>(merged.name, merged.vertices, merged.indices, merged.collisionSphere);
+			cluster.objectSlot = components.allocateObjectSlot();
+			_clusters.push_back(std::move(cluster));
+		}
+		return !_clusters.empty();
+	}
+
+	std::vector<ChunkStaticGeometry::MergedCluster> ChunkStaticGeometry::merge(const std::vector<BakeObject>& objects, glm::ivec2 chunkPos,
+	                                                                              const std::atomic<bool>& cancelled) {
+		WDE_PROFILE_FUNCTION();
+
+		// Group the static game objects by material and cluster (ordered by material to draw them in batches)
+		std::map<std::tuple<uint32_t, int, int>, std::vector<const BakeObject*>> groups {};
+		for (auto& object : objects) {
+			int clusterX = static_cast<int>(std::floor(object.transform[3].x / static_cast<float>(Config::CHUNK_STATIC_CLUSTER_SIZE)));
+			int clusterZ = static_cast<int>(std::floor(object.transform[3].z / static_cast<float>(Config::CHUNK_STATIC_CLUSTER_SIZE)));
+			groups[{object.materialID, clusterX, clusterZ}].push_back(&object);
+		}
+
+		// Merge each group
+		std::vector<MergedCluster> clusters {};
+		std::size_t bakedObjectsCount = 0;
+		for (auto& group : groups) {
+			if (group.second.size() < static_cast<std::size_t>(Config::CHUNK_STATIC_CLUSTER_MIN_OBJECTS))
+				continue;
+			if (cancelled)
+				return {};
+			WDE_PROFILE_SCOPE("wde::scene::ChunkStaticGeometry::merge::mergeCluster");
+
+			MergedCluster cluster {};
+			cluster.material = group.second.front()->material;
+			cluster.name = "Chunk (" + std::to_string(chunkPos.x) + ", " + std::to_string(chunkPos.y) + ") static cluster " + std::to_string(clusters.size());
+			glm::vec3 boundsMin {std::numeric_limits<float>::max()};
+			glm::vec3 boundsMax {std::numeric_limits<float>::lowest()};
+			for (auto object : group.second) {
+				auto geometry = object->geometry->get();
+				const glm::mat4& transform = object->transform;
+				glm::mat3 normalTransform = glm::transpose(glm::inverse(glm::mat3(transform)));
+
+				// Indices (offset by the merged vertices)
+				auto indexOffset = static_cast<uint32_t>(cluster.vertices.size());
+				for (uint32_t index : geometry->indices)
+					cluster.indices.push_back(index + indexOffset);
+
+				// Vertices (transformed to world space)
+				for (const auto& vertex : geometry->vertices) {
+					resource::Vertex v = vertex;
+					v.position = glm::vec3(transform * glm::vec4(vertex.position, 1.0f));
+					glm::vec3 normal = normalTransform * vertex.normal;
+					if (glm::dot(normal, normal) > 0.0f)
+						v.normal = glm::normalize(normal);
+					boundsMin = glm::min(boundsMin, v.position);
+					boundsMax = glm::max(boundsMax, v.position);
+					cluster.vertices.push_back(v);
+				}
+
+				// Remember the merged game object
+				cluster.sources.emplace_back(object->objectSlot, object->source);
+			}
+
+			// Cluster collision sphere
+			glm::vec3 center = (boundsMin + boundsMax) * 0.5f;
+			float radius = 0.0f;
+			for (const auto& v : cluster.vertices)
+				radius = std::max(radius, glm::length(v.position - center));
+			cluster.collisionSphere = glm::vec4(center, radius);
+			bakedObjectsCount += cluster.sources.size();
+			clusters.push_back(std::move(cluster));
+		}
+
+		if (!clusters.empty())
+			logger::log(LogLevel::DEBUG, LogChannel::SCENE) << "Baked " << bakedObjectsCount << " static game objects of chunk (" << chunkPos.x << ", "
+				<< chunkPos.y << ") into " << clusters.size() << " clusters." << logger::endl;
+		return clusters;
+	}
+
+	void ChunkStaticGeometry::cancelBake() {
+		if (!_bake.valid())
+			return;
+		WDE_PROFILE_FUNCTION();
+		*_bakeCancelled = true;
+		_bake.wait();
+		_bake = {};
+		_bakeCancelled.reset();
+	}
+
+	std::vector<std::unique_ptr<render::Buffer>> ChunkStaticGeometry::release(ChunkComponents& components) {
+		WDE_PROFILE_FUNCTION();
+		cancelBake();
+		std::vector<std::unique_ptr<render::Buffer>> buffers {};
+		for (auto& cluster : _clusters) {
+			for (auto& buffer : cluster.mesh->releaseBuffers())
+				buffers.push_back(std::move(buffer));
+			components.releaseObjectSlot(cluster.objectSlot);
+		}
+		_clusters.clear();
+		_sources.clear();
+		_bakedObjectsCount = 0;
+		return buffers;
+	}
+
+	bool ChunkStaticGeometry::isOutdated(const ChunkComponents& components) const {
+		WDE_PROFILE_FUNCTION();
+		std::size_t foundCount = 0;
+		for (auto& entry : components.getMeshRenderers()) {
+			if (!isBaked(entry.objectSlot))
+				continue;
+
+			const Source& source = _sources[entry.objectSlot];
+			if (source.meshRenderer != entry.meshRenderer || !entry.gameObject->active
+					|| source.transformVersion != entry.transform->getTransformVersion()
+					|| source.mesh != entry.meshRenderer->getMesh() || source.material != entry.meshRenderer->getMaterial())
+				return true;
+			foundCount++;
+		}
+
+		// A merged game object was removed
+		return foundCount != _bakedObjectsCount;
+	}
+}
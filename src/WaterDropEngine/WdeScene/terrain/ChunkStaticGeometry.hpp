@@ -0,0 +1,130 @@
+#pragma once
+
+#include <future>
+#include <atomic>
+
+#include "../../../wde.hpp"
+#include "../../WdeResourceManager/resources/Mesh.hpp"
+#include "../../WdeResourceManager/resources/Material.hpp"
+#include "ChunkComponents.hpp"
+
+namespace wde::scene {
+	/**
+	 * Static game objects of a chunk merged into combined meshes, with their transforms applied to the vertices.
+	 * Game objects sharing a material are merged by spatial clusters, so that each cluster can still be culled.
+	 * Each cluster is drawn with its own objects buffer slot (identity transform). The baked geometry is outdated as soon
+	 * as one of its source game objects changes, and must then be released so that the game objects are drawn again.
+	 * The vertices are merged on a worker thread, only the clusters GPU meshes are created on the main thread.
+	 */
+	class ChunkStaticGeometry : public NonCopyable {
+		public:
+			/** Merged static game objects sharing a material */
+			struct Cluster {
+				/** Material of the merged game objects */
+				resource::Material* material;
+				/** Merged vertices (in world space) */
+				std::unique_ptr<resource::Mesh> mesh;
+				/** Slot of the cluster in the chunk objects buffer */
+				uint32_t objectSlot;
+			};
+
+			ChunkStaticGeometry() = default;
+			~ChunkStaticGeometry() override;
+
+			// Core functions
+			/**
+			 * Starts merging the static game objects of a chunk on a worker thread (the previous baked geometry must be released).
+			 * The game objects are drawn separately until finishBake() creates the clusters.
+			 * @param components Packed modules of the chunk (with updated transforms)
+			 * @param chunkPos Position of the chunk (to name the clusters)
+			 */
+			void startBake(const ChunkComponents& components, glm::ivec2 chunkPos);
+			/**
+			 * Creates the clusters GPU meshes once the worker thread merged them (main thread). The merged vertices are dropped
+			 * if one of their game objects changed during the merge.
+			 * @param components Packed modules of the chunk (the clusters objects buffer slots are allocated from them)
+			 * @return True if clusters were created (they must be uploaded to the chunk objects buffer)
+			 */
+			bool finishBake(ChunkComponents& components);
+			/**
+			 * Stops the merge in progress, and releases the clusters and their objects buffer slots
+			 * @param components Packed modules of the chunk
+			 * @return The released buffers, that must be kept alive until the frames using them are done
+			 */
+			std::vector<std::unique_ptr<render::Buffer>> release(ChunkComponents& components);
+			/**
+			 * @param components Packed modules of the chunk (with updated transforms)
+			 * @return True if one of the merged game objects was removed or changed since the geometry was baked
+			 */
+			bool isOutdated(const ChunkComponents& components) const;
+
+
+			// Getters
+			/**
+			 * @param objectSlot Objects buffer slot of a mesh renderer
+			 * @return True if the game object is drawn by a cluster
+			 */
+			bool isBaked(uint32_t objectSlot) const { return objectSlot < _sources.size() && _sources[objectSlot].meshRenderer != nullptr; }
+			const std::vector<Cluster>& getClusters() const { return _clusters; }
+			bool empty() const { return _clusters.empty(); }
+			/** @return True if the static game objects are being merged by a worker thread */
+			bool isBaking() const { return _bake.valid(); }
+			/** @return The number of game objects drawn by the clusters */
+			std::size_t getBakedObjectsCount() const { return _bakedObjectsCount; }
+
+
+		private:
+			/** Merged game object state when it was baked */
+			struct Source {
+				const MeshRendererModule* meshRenderer = nullptr;
+				uint64_t transformVersion = 0;
+				const resource::Mesh* mesh = nullptr;
+				const resource::Material* material = nullptr;
+			};
+			/** Static game object to merge (copied for the worker thread) */
+			struct BakeObject {
+				/** Geometry of the game object mesh */
+				std::shared_ptr<resource::MeshGeometrySource> geometry;
+				/** Material of the game object (not accessed by the worker thread) */
+				resource::Material* material;
+				uint32_t materialID;
+				glm::mat4 transform;
+				uint32_t objectSlot;
+				Source source;
+			};
+			/** Cluster merged by the worker thread, waiting for its GPU mesh */
+			struct MergedCluster {
+				resource::Material* material;
+				std::string name;
+				std::vector<resource::Vertex> vertices {};
+				std::vector<uint32_t> indices {};
+				glm::vec4 collisionSphere {0.0f};
+				/** Merged game objects (objects buffer slot and state when baked) */
+				std::vector<std::pair<uint32_t, Source>> sources {};
+			};
+
+			/** Clusters of the chunk */
+			std::vector<Cluster> _clusters {};
+			/** Merged game objects, indexed by their objects buffer slot (null mesh renderer if not merged) */
+			std::vector<Source> _sources {};
+			/** Number of merged game objects */
+			std::size_t _bakedObjectsCount = 0;
+
+			// Baking
+			/** Clusters being merged by the worker thread */
+			std::future<std::vector<MergedCluster>> _bake {};
+			/** Set to stop the merge in progress */
+			std::shared_ptr<std::atomic<bool>> _bakeCancelled {};
+
+			/**
+			 * Merges static game objects by material and cluster (worker thread)
+			 * @param objects Static game objects of the chunk
+			 * @param chunkPos Position of the chunk (to name the clusters)
+			 * @param cancelled Stops the merge when set
+			 * @return The merged clusters
+			 */
+			static std::vector<MergedCluster> merge(const std::vector<BakeObject>& objects, glm::ivec2 chunkPos, const std::atomic<bool>& cancelled);
+			/** Stops the merge in progress (waits for the cluster being merged) */
+			void cancelBake();
+	};
+}
@@ -0,0 +1,186 @@
+#include "../src/WaterDropEngine/WdeCore/Core/WdeInstance.hpp"
+
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+
+/**
+ * Grows a chunk to 100k dynamic game objects, moves all of them to the next chunk and deletes them, checking the chunks
+ * contents after each phase and printing the duration of each phase.
+ * Usage : ChunkStressTest --headless --scene res/stress_scene/scene.json --steps 30 [--objects <count>]
+ */
+namespace tests {
+	using namespace wde;
+	using namespace wde::scene;
+
+	class ChunkStressTest : public WdeInstance {
+		public:
+			explicit ChunkStressTest(std::size_t objectsCount) : _objectsCount(objectsCount) {}
+
+			void initialize() override { }
+
+			void update() override {
+				auto now = std::chrono::steady_clock::now();
+				double frameTime = std::chrono::duration<double, std::milli>(now - _lastUpdateTime).count();
+				_lastUpdateTime = now;
+				_phaseFrames++;
+
+				switch (_phase) {
+					case Phase::CREATE: {
+						// Chunks initial content (chunks saved by a previous run can hold game objects)
+						_sourceChunk = _scene->getChunkSync({0, 0});
+						_initialSourceCount = _sourceChunk->getGameObjects().size();
+						_initialTargetCount = _scene->getChunkSync({1, 0})->getGameObjects().size();
+						_initialRegistryCount = GameObject::getCount();
+
+						// Create the game objects in the chunk (0, 0)
+						auto start = std::chrono::steady_clock::now();
+						float halfSize = static_cast<float>(Config::CHUNK_SIZE) * 0.45f;
+						std::size_t side = static_cast<std::size_t>(std::ceil(std::sqrt(static_cast<double>(_objectsCount))));
+						_gameObjects.reserve(_objectsCount);
+						for (std::size_t i = 0; i < _objectsCount; i++) {
+							auto go = _sourceChunk->createGameObject("Stress " + std::to_string(i));
+							go->transform->position = {
+								-halfSize + 2.0f * halfSize * static_cast<float>(i % side) / static_cast<float>(side),
+								0.0f,
+								-halfSize + 2.0f * halfSize * static_cast<float>(i / side) / static_cast<float>(side)
+							};
+							_gameObjects.push_back(go->getHandle());
+						}
+						report("Creation", start, std::chrono::steady_clock::now());
+						check(_sourceChunk->getGameObjects().size() == _initialSourceCount + _objectsCount, "the source chunk does not hold the created game objects");
+						nextPhase(Phase::IDLE);
+						break;
+					}
+
+					case Phase::IDLE: {
+						// Frame with the game objects simulated and ticked, but not moving (reference for the next phases)
+						if (_phaseFrames < 3)
+							break;
+						std::cout << "  Idle frame : " << frameTime << " ms" << std::endl;
+						if (_sourceChunk->hasBuffers())
+							check(_sourceChunk->getObjectsCapacity() >= _sourceChunk->getGameObjects().size(), "the source chunk objects buffer did not grow");
+
+						// Move every game object to the chunk (1, 0), they are migrated by this frame scene tick
+						for (auto handle : _gameObjects)
+							GameObject::find(handle)->transform->position.x += static_cast<float>(Config::CHUNK_SIZE);
+						_phaseStart = std::chrono::steady_clock::now();
+						nextPhase(Phase::MIGRATE);
+						break;
+					}
+
+					case Phase::MIGRATE: {
+						auto target = _scene->getActiveChunks().find({1, 0});
+						if (target == nullptr || (*target)->getGameObjects().size() != _initialTargetCount + _objectsCount) {
+							check(_phaseFrames < MAX_PHASE_FRAMES, "the game objects were not migrated to the target chunk");
+							break;
+						}
+						report("Migration frame", _phaseStart, now);
+						check(_sourceChunk->getGameObjects().size() == _initialSourceCount, "migrated game objects are still in the source chunk");
+						for (auto handle : _gameObjects)
+							check(GameObject::find(handle) != nullptr, "a migrated game object was destroyed");
+						if ((*target)->hasBuffers())
+							check((*target)->getObjectsCapacity() >= (*target)->getGameObjects().size(), "the target chunk objects buffer did not grow");
+
+						// Delete every game object, they are deleted by the next simulation step
+						_targetChunk = target->get();
+						for (auto handle : _gameObjects)
+							_targetChunk->removeGameObject(GameObject::find(handle));
+						_phaseStart = std::chrono::steady_clock::now();
+						nextPhase(Phase::DELETE);
+						break;
+					}
+
+					case Phase::DELETE: {
+						if (_targetChunk->getGameObjects().size() != _initialTargetCount) {
+							check(_phaseFrames < MAX_PHASE_FRAMES, "the game objects were not deleted from the target chunk");
+							break;
+						}
+						report("Deletion frame", _phaseStart, now);
+						check(GameObject::getCount() == _initialRegistryCount, "deleted game objects are still registered");
+						for (auto handle : _gameObjects)
+							check(GameObject::find(handle) == nullptr, "a deleted game object handle still resolves");
+						_gameObjects.clear();
+						nextPhase(Phase::DONE);
+						std::cout << "Chunk stress test passed." << std::endl;
+						break;
+					}
+
+					case Phase::DONE:
+						break;
+				}
+			}
+
+			void cleanUp() override {
+				if (_phase != Phase::DONE)
+					std::cout << "Chunk stress test did not complete (more simulation steps are needed, see --steps)." << std::endl;
+			}
+
+			/** @return True if every phase ran and passed its checks */
+			bool hasPassed() const { return _phase == Phase::DONE; }
+
+
+		private:
+			enum class Phase { CREATE, IDLE, MIGRATE, DELETE, DONE };
+			/** Number of frames a phase can wait for the scene before failing */
+			static constexpr std::size_t MAX_PHASE_FRAMES = 20;
+
+			std::size_t _objectsCount;
+			Phase _phase = Phase::CREATE;
+			std::size_t _phaseFrames = 0;
+			std::chrono::steady_clock::time_point _phaseStart {};
+			std::chrono::steady_clock::time_point _lastUpdateTime = std::chrono::steady_clock::now();
+
+			// Checked state
+			std::vector<GameObjectHandle> _gameObjects {};
+			Chunk* _sourceChunk = nullptr;
+			Chunk* _targetChunk = nullptr;
+			std::size_t _initialSourceCount = 0;
+			std::size_t _initialTargetCount = 0;
+			std::size_t _initialRegistryCount = 0;
+
+			void nextPhase(Phase phase) {
+				_phase = phase;
+				_phaseFrames = 0;
+			}
+
+			void report(const std::string& name, std::chrono::steady_clock::time_point start, std::chrono::steady_clock::time_point end) const {
+				double duration = std::chrono::duration<double, std::milli>(end - start).count();
+				std::cout << "  " << name << " : " << duration << " ms (" << duration * 1e6 / static_cast<double>(_objectsCount)
+				          << " ns per game object, " << _objectsCount << " game objects)" << std::endl;
+			}
+
+			static void check(bool condition, const std::string& message) {
+				if (!condition)
+					throw WdeException(LogChannel::SCENE, "Chunk stress test failed : " + message + ".");
+			}
+	};
+}
+
+
+int main(int argc, char* argv[]) {
+	// Game objects count option, the other options are read by the engine
+	std::size_t objectsCount = 100000;
+	std::vector<char*> engineArgs {argv[0]};
+	for (int i = 1; i < argc; i++) {
+		if (std::strcmp(argv[i], "--objects") == 0 && i + 1 < argc)
+			objectsCount = std::strtoul(argv[++i], nullptr, 10);
+		else
+			engineArgs.push_back(argv[i]);
+	}
+	if (objectsCount == 0) {
+		std::cout << "Invalid game objects count (expected a positive integer)." << std::endl;
+		return 2;
+	}
+
+	try {
+		tests::ChunkStressTest instance {objectsCount};
+		instance.startInstance(static_cast<int>(engineArgs.size()), engineArgs.data());
+		return instance.hasPassed() ? 0 : 1;
+	}
+	catch (const std::exception& e) {
+		std::cout << e.what() << std::endl;
+		return 1;
+	}
+}
@@ -0,0 +1,138 @@
+#include "../src/WaterDropEngine/WdeCommon/WdeUtils/RadixSort.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <memory>
+#include <random>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * Compares the drawing order of the chunk mesh renderers (64-bit render keys sorted with wde::radixSort) with the previous
+ * grouping of the game objects in nested unordered maps by material and mesh, and with std::stable_sort of the same keys.
+ * Checks that the radix sort orders the keys as std::stable_sort does, and prints the duration of each method.
+ * Usage : RenderKeysBenchmark [materials count] [meshes count]
+ */
+namespace {
+	// Simplified engine types (only the data used by the render keys)
+	struct Material { uint32_t id; };
+	struct Mesh { uint32_t id; };
+	struct GameObject { Material* material; Mesh* mesh; };
+
+	/** Same layout and key as ChunkComponents::MeshRendererEntry */
+	struct MeshRendererEntry {
+		GameObject* gameObject;
+		uint32_t objectSlot;
+		uint64_t renderKey;
+	};
+
+	/** Same bits as ChunkComponents::getRenderKey() (render stage 0) */
+	uint64_t getRenderKey(const MeshRendererEntry& entry) {
+		return (static_cast<uint64_t>(entry.gameObject->material->id & 0xFFFFFF) << 32)
+			| (static_cast<uint64_t>(entry.gameObject->mesh->id & 0xFFFFFF) << 8);
+	}
+
+	/** @return The median duration of the runs of a function (in microseconds) */
+	template<typename F>
+	double time(F function, int iterations) {
+		function(); // Warm up
+		std::vector<double> times {};
+		for (int i = 0; i < iterations; i++) {
+			auto start = std::chrono::steady_clock::now();
+			function();
+			times.push_back(std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count());
+		}
+		std::sort(times.begin(), times.end());
+		return times[times.size() / 2];
+	}
+}
+
+int main(int argc, char** argv) {
+	std::size_t materialsCount = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 16;
+	std::size_t meshesCount = argc > 2 ? std::strtoul(argv[2], nullptr, 10) : 32;
+	if (materialsCount == 0 || meshesCount == 0) {
+		std::printf("Usage : RenderKeysBenchmark [materials count > 0] [meshes count > 0]\n");
+		return 2;
+	}
+
+	std::vector<Material> materials(materialsCount);
+	std::vector<Mesh> meshes(meshesCount);
+	for (std::size_t i = 0; i < materialsCount; i++)
+		materials[i].id = static_cast<uint32_t>(i);
+	for (std::size_t i = 0; i < meshesCount; i++)
+		meshes[i].id = static_cast<uint32_t>(i);
+	std::printf("%zu materials, %zu meshes, median durations\n", materialsCount, meshesCount);
+
+	bool passed = true;
+	for (std::size_t count : {1000, 10000, 100000}) {
+		// Game objects with random materials and meshes
+		std::mt19937 random(42);
+		std::vector<std::shared_ptr<GameObject>> gameObjects {};
+		for (std::size_t i = 0; i < count; i++)
+			gameObjects.push_back(std::make_shared<GameObject>(GameObject {&materials[random() % materialsCount], &meshes[random() % meshesCount]}));
+		std::vector<MeshRendererEntry> initialEntries {};
+		for (std::size_t i = 0; i < count; i++)
+			initialEntries.push_back({gameObjects[i].get(), static_cast<uint32_t>(i), 0});
+		int iterations = count >= 100000 ? 21 : 201;
+
+		// Previous WdeSceneInstance::reorderGO() grouping (nested maps of shared pointers, then copied back to the lists)
+		double nestedMaps = time([&] {
+			std::unordered_map<Material*, std::unordered_map<Mesh*, std::vector<std::shared_ptr<GameObject>>>> groups {};
+			for (auto& go : gameObjects)
+				groups[go->material][go->mesh].push_back(go);
+			std::vector<std::shared_ptr<GameObject>> ordered {};
+			std::vector<std::shared_ptr<GameObject>> dynamicObjects {};
+			for (auto& material : groups) {
+				for (auto& mesh : material.second) {
+					for (auto& go : mesh.second) {
+						ordered.push_back(go);
+						dynamicObjects.push_back(go);
+					}
+				}
+			}
+		}, iterations);
+
+		// Render keys computed and sorted (as in ChunkComponents::build())
+		std::vector<MeshRendererEntry> entries {};
+		std::vector<MeshRendererEntry> scratch {};
+		double radix = time([&] {
+			entries = initialEntries;
+			for (auto& entry : entries)
+				entry.renderKey = getRenderKey(entry);
+			wde::radixSort(entries, scratch, [](const MeshRendererEntry& entry) { return entry.renderKey; });
+		}, iterations);
+
+		std::vector<MeshRendererEntry> expected {};
+		double stableSort = time([&] {
+			expected = initialEntries;
+			for (auto& entry : expected)
+				entry.renderKey = getRenderKey(entry);
+			std::stable_sort(expected.begin(), expected.end(), [](const MeshRendererEntry& a, const MeshRendererEntry& b) { return a.renderKey < b.renderKey; });
+		}, iterations);
+
+		// Render keys checked without any change (as in ChunkComponents::updateRenderOrder() on most frames)
+		double unchanged = time([&] {
+			bool changed = false;
+			for (auto& entry : entries) {
+				uint64_t key = getRenderKey(entry);
+				if (key != entry.renderKey) {
+					entry.renderKey = key;
+					changed = true;
+				}
+			}
+			if (changed)
+				wde::radixSort(entries, scratch, [](const MeshRendererEntry& entry) { return entry.renderKey; });
+		}, iterations);
+
+		// The radix sort is stable, so it gives the same order as std::stable_sort
+		bool valid = std::equal(entries.begin(), entries.end(), expected.begin(), expected.end(), [](const MeshRendererEntry& a, const MeshRendererEntry& b) {
+			return a.gameObject == b.gameObject && a.renderKey == b.renderKey;
+		});
+		std::printf("  %6zu game objects : nested maps %9.1f us, radix sort %8.1f us (x%.1f), stable_sort %8.1f us, unchanged keys check %7.1f us %s\n",
+		            count, nestedMaps, radix, nestedMaps / radix, stableSort, unchanged, valid ? "OK" : "FAILED");
+		passed = passed && valid;
+	}
+	return passed ? 0 : 1;
+}
@@ -0,0 +1,596 @@
+#include "../src/WaterDropEngine/WdeCore/Core/WdeInstance.hpp"
+#include "../app/examples/04-Indirect_Culling/PipelineExample04.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <functional>
+#include <map>
+#include <type_traits>
+
+/**
+ * Headless scene benchmarks : each benchmark runs a list of cases (a scene configuration and its game objects), and
+ * prints the median duration of the frames of each case (simulation step and scene tick, without the case own updates).
+ * Usage : SceneBenchmark --headless --scene res/stress_scene/scene.json --benchmark <name|all> [--frames <count>]
+ * (the simulation steps count is computed from the cases if --steps is not given)
+ * The packedModules benchmark uploads to the render device : SceneBenchmark --scene res/demo_scene/scene.json --benchmark packedModules
+ * (without --headless, the window is closed once every case ran)
+ */
+namespace tests {
+	using namespace wde;
+	using namespace wde::scene;
+
+	class SceneBenchmark : public WdeInstance {
+		public:
+			/** Measured configuration of a benchmark */
+			struct Case {
+				std::string name;
+				/** Sets the config and creates the game objects (first frame of the case) */
+				std::function<void()> setup = [] {};
+				/** Changes the game objects before each frame scene tick (not measured) */
+				std::function<void()> update = [] {};
+				/** False if the case measures and prints its own durations in setup() (no measured frames) */
+				bool measureFrames = true;
+			};
+
+			SceneBenchmark(const std::string& benchmark, std::size_t framesCount) : _framesCount(framesCount) {
+				std::map<std::string, std::function<std::vector<Case>()>> benchmarks {
+					{ "chunkFiles", [this] { return chunkFilesBenchmark(); } },
+					{ "chunkBookkeeping", [this] { return chunkBookkeepingBenchmark(); } },
+					{ "packedModules", [this] { return packedModulesBenchmark(); } },
+					{ "moduleLookup", [this] { return moduleLookupBenchmark(); } },
+					{ "transforms", [this] { return transformsBenchmark(); } },
+					{ "tickThreads", [this] { return tickThreadsBenchmark(); } },
+					{ "simulationLOD", [this] { return simulationLODBenchmark(); } },
+					{ "deletion", [this] { return deletionBenchmark(); } }
+				};
+				for (auto& [name, createCases] : benchmarks) {
+					if (benchmark != "all" && benchmark != name)
+						continue;
+					for (auto& c : createCases())
+						_cases.push_back(std::move(c));
+				}
+				if (_cases.empty())
+					throw WdeException(LogChannel::CORE, "Unknown benchmark \"" + benchmark + "\".");
+			}
+
+			void initialize() override {
+				if (!Config::HEADLESS)
+					setRenderPipeline(std::make_shared<examples::PipelineExample04>());
+			}
+
+			void update() override {
+				auto now = std::chrono::steady_clock::now();
+				double frameTime = std::chrono::duration<double, std::milli>(now - _updateEnd).count();
+				if (_caseIndex < _cases.size())
+					updateCase(frameTime);
+				if (isDone() && !Config::HEADLESS)
+					glfwSetWindowShouldClose(WaterDropEngine::get().getRender().getWindow().getWindow(), GLFW_TRUE);
+				_updateEnd = std::chrono::steady_clock::now();
+			}
+
+			void cleanUp() override {
+				if (_caseIndex < _cases.size())
+					std::cout << "Benchmark did not complete (more simulation steps are needed, see --steps)." << std::endl;
+			}
+
+			/** @return The number of simulation steps needed to run every case */
+			std::size_t getRequiredSteps() const { return _cases.size() * (_framesCount + WARMUP_FRAMES + 4) + 10; }
+			/** @return True if every case ran */
+			bool isDone() const { return _caseIndex >= _cases.size(); }
+
+
+		private:
+			/** Frames run before measuring a case (chunks activation, first matrices computation) */
+			static constexpr std::size_t WARMUP_FRAMES = 10;
+			/** Number of runs of the one-shot measurements (the median is kept) */
+			static constexpr int ITERATIONS = 5;
+
+			std::vector<Case> _cases {};
+			std::size_t _framesCount;
+			std::size_t _caseIndex = 0;
+			/** Frame of the current case (0 = setup) */
+			std::size_t _caseFrame = 0;
+			std::vector<double> _frameTimes {};
+			std::chrono::steady_clock::time_point _updateEnd = std::chrono::steady_clock::now();
+
+			// Scene state
+			/** Game objects created by the current case (chunk position and handle) */
+			std::vector<std::pair<glm::ivec2, GameObjectHandle>> _spawned {};
+			/** Index of the current frame (moving game objects) */
+			std::size_t _frameIndex = 0;
+			/** Config values changed by the cases */
+			int _loadedDistance = Config::CHUNK_LOADED_DISTANCE;
+			int _unloadedDistance = Config::CHUNK_UNLOADED_DISTANCE;
+			int _tickThreadsCount = Config::CHUNK_TICK_THREADS_COUNT;
+			std::vector<int> _tickIntervals = Config::CHUNK_TICK_INTERVALS;
+
+
+			// Cases
+			void updateCase(double frameTime) {
+				auto& c = _cases[_caseIndex];
+				_frameIndex++;
+
+				// Setup
+				if (_caseFrame == 0) {
+					c.setup();
+					_frameTimes.clear();
+					_caseFrame = c.measureFrames ? 1 : WARMUP_FRAMES + _framesCount;
+				}
+				// Warm-up and measured frames (the frame time is the duration of the previous frame)
+				else if (_caseFrame < WARMUP_FRAMES + _framesCount) {
+					if (_caseFrame > WARMUP_FRAMES)
+						_frameTimes.push_back(frameTime);
+					_caseFrame++;
+				}
+				// End of the case, the game objects are deleted by the next step
+				else {
+					if (c.measureFrames) {
+						_frameTimes.push_back(frameTime);
+						std::sort(_frameTimes.begin(), _frameTimes.end());
+						std::cout << "  " << c.name << " : " << _frameTimes[_frameTimes.size() / 2] << " ms per frame (median of "
+						          << _frameTimes.size() << " frames)" << std::endl;
+					}
+					despawnAll();
+					restoreConfig();
+					_caseFrame = 0;
+					_caseIndex++;
+					if (_caseIndex == _cases.size())
+						std::cout << "Benchmark done." << std::endl;
+					return;
+				}
+				c.update();
+			}
+
+			void restoreConfig() {
+				Config::CHUNK_LOADED_DISTANCE = _loadedDistance;
+				Config::CHUNK_UNLOADED_DISTANCE = _unloadedDistance;
+				Config::CHUNK_TICK_THREADS_COUNT = _tickThreadsCount;
+				Config::CHUNK_TICK_INTERVALS = _tickIntervals;
+			}
+
+			/**
+			 * Sets the loaded chunks radius and activates every chunk of the loaded area now (instead of streaming them)
+			 * @param radius Radius of the loaded area (in chunks)
+			 */
+			void activateArea(int radius) {
+				Config::CHUNK_LOADED_DISTANCE = radius;
+				Config::CHUNK_UNLOADED_DISTANCE = radius + 1;
+				for (int x = -radius; x <= radius; x++)
+					for (int y = -radius; y <= radius; y++)
+						_scene->getChunkSync({x, y});
+			}
+
+			/**
+			 * Creates game objects spread over a chunk
+			 * @param pos Position of the chunk
+			 * @param count Number of game objects
+			 * @return The created game objects
+			 */
+			std::vector<GameObject*> spawn(glm::ivec2 pos, std::size_t count) {
+				auto chunk = _scene->getChunkSync(pos);
+				std::vector<GameObject*> gameObjects {};
+				gameObjects.reserve(count);
+				float halfSize = static_cast<float>(Config::CHUNK_SIZE) * 0.4f;
+				auto side = static_cast<std::size_t>(std::ceil(std::sqrt(static_cast<double>(count))));
+				for (std::size_t i = 0; i < count; i++) {
+					auto go = chunk->createGameObject("Benchmark " + std::to_string(i));
+					go->transform->position = {
+						static_cast<float>(pos.x * Config::CHUNK_SIZE) - halfSize + 2.0f * halfSize * static_cast<float>(i % side) / static_cast<float>(side),
+						0.0f,
+						static_cast<float>(pos.y * Config::CHUNK_SIZE) - halfSize + 2.0f * halfSize * static_cast<float>(i / side) / static_cast<float>(side)
+					};
+					_spawned.emplace_back(pos, go->getHandle());
+					gameObjects.push_back(go.get());
+				}
+				return gameObjects;
+			}
+
+			/** Removes the game objects created by the current case from their chunk */
+			void despawnAll() {
+				for (auto& [pos, handle] : _spawned) {
+					if (auto go = GameObject::find(handle))
+						_scene->getChunkSync(pos)->removeGameObject(go);
+				}
+				_spawned.clear();
+			}
+
+			/** @return The median duration of the runs of a function (in milliseconds) */
+			template<typename F>
+			static double measure(F function) {
+				std::vector<double> times {};
+				for (int i = 0; i < ITERATIONS; i++) {
+					auto start = std::chrono::steady_clock::now();
+					function();
+					times.push_back(std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count());
+				}
+				std::sort(times.begin(), times.end());
+				return times[times.size() / 2];
+			}
+
+
+
+			// Benchmarks
+			/** Saving and loading a chunk of 1k and 10k game objects, in the binary and JSON formats */
+			std::vector<Case> chunkFilesBenchmark() {
+				std::vector<Case> cases {};
+				for (std::size_t count : {1000, 10000}) {
+					Case c {"Chunk files (" + std::to_string(count) + " game objects)"};
+					c.measureFrames = false;
+					c.setup = [this, count] {
+						glm::ivec2 pos {1000, 1000}; // Outside of the loaded area
+						std::string path = _scene->getPath() + "chunk/chunk_" + std::to_string(pos.x) + "-" + std::to_string(pos.y);
+						double binarySave, jsonSave, binaryLoad, jsonLoad;
+						{
+							Chunk chunk {_scene.get(), pos, false};
+							for (std::size_t i = 0; i < count; i++) {
+								auto go = chunk.createGameObject("Benchmark " + std::to_string(i), i % 2 == 0);
+								go->transform->position = {static_cast<float>(i % 100), 0.0f, static_cast<float>(i / 100)};
+								go->transform->rotation = {0.0f, static_cast<float>(i) * 0.01f, 0.0f};
+							}
+							binarySave = measure([&] { chunk.save(); _scene->getChunkSaver().flush(); });
+							jsonSave = measure([&] { chunk.exportJSON(); _scene->getChunkSaver().flush(); });
+						}
+
+						// The JSON file is loaded while it is more recent than the binary file (the loaded game objects are destroyed in the measure)
+						jsonLoad = measure([&] { Chunk chunk {_scene.get(), pos, true}; check(chunk.getGameObjects().size() == count); });
+						std::filesystem::last_write_time(path + ".json", std::filesystem::last_write_time(path + ChunkFile::EXTENSION) - std::chrono::seconds(10));
+						binaryLoad = measure([&] { Chunk chunk {_scene.get(), pos, true}; check(chunk.getGameObjects().size() == count); });
+
+						std::cout << "  Chunk files (" << count << " game objects) : save binary " << binarySave << " ms, JSON " << jsonSave
+						          << " ms - load binary " << binaryLoad << " ms, JSON " << jsonLoad << " ms (median of " << ITERATIONS << " runs)" << std::endl;
+						std::filesystem::remove(path + ChunkFile::EXTENSION);
+						std::filesystem::remove(path + ".json");
+						_scene->setChunkOccupied(pos, false);
+					};
+					cases.push_back(std::move(c));
+				}
+				return cases;
+			}
+
+			/** Per-frame scene bookkeeping of empty chunks (chunks grids, loaded area, chunks steps and ticks) at loaded distances from 3 to 32 */
+			std::vector<Case> chunkBookkeepingBenchmark() {
+				std::vector<Case> cases {};
+				for (int radius : {3, 8, 16, 32}) {
+					Case c {"Chunk bookkeeping (loaded distance " + std::to_string(radius) + ", " + std::to_string((2 * radius + 1) * (2 * radius + 1)) + " chunks)"};
+					c.setup = [this, radius] { activateArea(radius); };
+					cases.push_back(std::move(c));
+				}
+				return cases;
+			}
+
+			/**
+			 * Objects buffer upload (as Chunk::tick() does) and culling batches of 10k rendered game objects of a chunk, through the
+			 * chunk packed modules lists and through a walk of the game objects modules as before the packed lists.
+			 * Needs the render device and the demo scene resources (run without --headless, with --scene res/demo_scene/scene.json).
+			 */
+			std::vector<Case> packedModulesBenchmark() {
+				Case c {"Packed modules (10000 rendered game objects)"};
+				c.measureFrames = false;
+				c.setup = [this] {
+					if (Config::HEADLESS) {
+						std::cout << "  Packed modules : skipped, the objects buffers and culling batches need the render device (run without --headless)" << std::endl;
+						return;
+					}
+					auto gameObjects = spawn({0, 0}, 10000);
+					for (auto go : gameObjects)
+						go->addModule<MeshRendererModule>(std::string_view {"fougere.json"}, std::string_view {"cube.json"});
+					auto chunk = _scene->getChunkSync({0, 0});
+					check(chunk->getComponents().getMeshRenderers().size() >= gameObjects.size());
+
+					// Buffers created and grown before measuring
+					auto objectsCount = static_cast<uint32_t>(chunk->getGameObjects().size());
+					CullingInstance culling {{0, 0}};
+					chunk->updateGOBuffers();
+					culling.createBatches(*chunk);
+					render::Buffer objectsData {sizeof(GameObject::GPUGameObjectData) * objectsCount, VK_BUFFER_USAGE_STORAGE_BUFFER_BIT};
+					render::Buffer renderBatches {sizeof(CullingInstance::GPURenderBatch) * objectsCount, VK_BUFFER_USAGE_STORAGE_BUFFER_BIT};
+					render::Buffer objectsBatches {sizeof(CullingInstance::GPUObjectBatch) * objectsCount, VK_BUFFER_USAGE_STORAGE_BUFFER_BIT};
+					std::vector<CullingInstance::CPURenderBatch> batches {};
+
+					// Every game object moved before each run, so that every one of them is uploaded (not measured)
+					auto measureMoved = [&](const auto& function) {
+						std::vector<double> times {};
+						for (int i = 0; i < ITERATIONS; i++) {
+							for (auto go : gameObjects)
+								go->transform->position.y += 0.01f;
+							TransformModule::nextFrame(1.0f);
+							for (auto go : gameObjects)
+								go->transform->getTransform();
+
+							auto start = std::chrono::steady_clock::now();
+							function();
+							times.push_back(std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count());
+						}
+						std::sort(times.begin(), times.end());
+						return times[times.size() / 2];
+					};
+					double packedUpload = measureMoved([&] { chunk->updateGOBuffers(); });
+					double unchangedUpload = measure([&] { chunk->updateGOBuffers(); });
+					double perGameObjectUpload = measureMoved([&] { uploadPerGameObject(*chunk, objectsData); });
+					double packedBatches = measure([&] { culling.createBatches(*chunk); });
+					double perGameObjectBatches = measure([&] { createBatchesPerGameObject(*chunk, {0, 0}, renderBatches, objectsBatches, batches); });
+					check(!batches.empty());
+
+					std::cout << "  Packed modules (" << gameObjects.size() << " rendered game objects) : objects buffer upload " << packedUpload
+					          << " ms (" << unchangedUpload << " ms unchanged), before " << perGameObjectUpload << " ms - culling batches " << packedBatches
+					          << " ms, before " << perGameObjectBatches << " ms (median of " << ITERATIONS << " runs)" << std::endl;
+				};
+				return {c};
+			}
+
+			/** Objects buffer upload before the packed lists : every game object of the chunk, with its modules looked up */
+			static void uploadPerGameObject(Chunk& chunk, render::Buffer& buffer) {
+				auto* objectsData = static_cast<GameObject::GPUGameObjectData*>(buffer.map());
+				uint32_t index = 0;
+				for (auto& go : chunk.getGameObjects()) {
+					auto meshRenderer = go->getModule<MeshRendererModule>();
+					if (!go->active || meshRenderer == nullptr || meshRenderer->getMesh() == nullptr || meshRenderer->getMaterial() == nullptr)
+						continue;
+					objectsData[index].transformWorldSpace = go->transform->getTransform();
+					objectsData[index++].collisionSphere = meshRenderer->getMesh()->getCollisionSphere();
+				}
+				buffer.unmap();
+			}
+
+			/** Culling batches before the packed lists : consecutive game objects of the chunk with the same material and mesh */
+			static void createBatchesPerGameObject(Chunk& chunk, std::pair<int, int> renderStage, render::Buffer& renderBatches,
+			                                       render::Buffer& objectsBatches, std::vector<CullingInstance::CPURenderBatch>& batches) {
+				batches.clear();
+				auto* gpuBatches = static_cast<CullingInstance::GPURenderBatch*>(renderBatches.map());
+				auto* gpuObjectsBatches = static_cast<CullingInstance::GPUObjectBatch*>(objectsBatches.map());
+				CullingInstance::CPURenderBatch currentBatch {};
+				auto pushBatch = [&] {
+					if (currentBatch.indexCount > 0) {
+						gpuBatches[batches.size()] = {currentBatch.firstIndex, currentBatch.indexCount, currentBatch.instanceCount};
+						batches.push_back(currentBatch);
+					}
+					currentBatch = {};
+				};
+
+				uint32_t objectID = 0;
+				for (auto& go : chunk.getGameObjects()) {
+					auto meshRenderer = go->getModule<MeshRendererModule>();
+					if (!go->active || meshRenderer == nullptr || meshRenderer->getMaterial() == nullptr || meshRenderer->getMesh() == nullptr
+					    || meshRenderer->getMaterial()->getRenderStage() != renderStage) {
+						pushBatch();
+						continue;
+					}
+					if (currentBatch.indexCount > 0 && (currentBatch.material != meshRenderer->getMaterial() || currentBatch.mesh != meshRenderer->getMesh()))
+						pushBatch();
+					if (currentBatch.indexCount == 0)
+						currentBatch = {meshRenderer->getMaterial(), meshRenderer->getMesh(), objectID, 0, 0};
+					currentBatch.indexCount++;
+					gpuObjectsBatches[objectID++] = {static_cast<uint32_t>(batches.size()), static_cast<uint32_t>(meshRenderer->getMesh()->getIndexCount())};
+				}
+				pushBatch();
+				objectsBatches.unmap();
+				renderBatches.unmap();
+			}
+
+			/**
+			 * Looking up the 4 module types (one of them missing) of 100k game objects with 5 modules each, with the typed module
+			 * slots and with a dynamic_cast walk of the modules
+			 */
+			std::vector<Case> moduleLookupBenchmark() {
+				Case c {"Module lookup (100000 game objects)"};
+				c.measureFrames = false;
+				c.setup = [this] {
+					auto gameObjects = spawn({0, 0}, 100000);
+					for (auto go : gameObjects) {
+						go->addModule<MeshRendererModule>();
+						go->addModule<ControllerModule>();
+						go->addModule<MeshRendererModule>();
+						go->addModule<ControllerModule>();
+					}
+					volatile std::size_t sink = 0;
+
+					auto findModule = [](GameObject* go, auto* type) {
+						using T = std::remove_pointer_t<decltype(type)>;
+						for (auto& module : go->getModules())
+							if (auto m = dynamic_cast<T*>(module.get()))
+								return m;
+						return static_cast<T*>(nullptr);
+					};
+					double slots = measure([&] {
+						std::size_t found = 0;
+						for (auto go : gameObjects) {
+							found += go->getModule<TransformModule>() != nullptr;
+							found += go->getModule<MeshRendererModule>() != nullptr;
+							found += go->getModule<ControllerModule>() != nullptr;
+							found += go->hasModule<CameraModule>();
+						}
+						sink = found;
+					});
+					double dynamicCast = measure([&] {
+						std::size_t found = 0;
+						for (auto go : gameObjects) {
+							found += findModule(go, static_cast<TransformModule*>(nullptr)) != nullptr;
+							found += findModule(go, static_cast<MeshRendererModule*>(nullptr)) != nullptr;
+							found += findModule(go, static_cast<ControllerModule*>(nullptr)) != nullptr;
+							found += findModule(go, static_cast<CameraModule*>(nullptr)) != nullptr;
+						}
+						sink = found;
+					});
+					std::cout << "  Module lookup (" << gameObjects.size() << " game objects, 5 modules each) : module slots " << slots
+					          << " ms, dynamic_cast walk " << dynamicCast << " ms (median of " << ITERATIONS << " runs)" << std::endl;
+				};
+				return {c};
+			}
+
+			/**
+			 * World matrices of 10k transforms in hierarchies of depth 1 (no parent), 4 and 8, when nothing moves, when the roots
+			 * move, and when every transform is marked as changed (the cached matrices are all recomputed)
+			 */
+			std::vector<Case> transformsBenchmark() {
+				enum class Mode { IDLE, ROOTS_MOVING, ALL_CHANGED };
+				std::vector<Case> cases {};
+				for (std::size_t depth : {1, 4, 8}) {
+					for (auto [mode, modeName] : {std::pair {Mode::IDLE, "idle"}, std::pair {Mode::ROOTS_MOVING, "roots moving"}, std::pair {Mode::ALL_CHANGED, "all changed"}}) {
+						auto nodes = std::make_shared<std::vector<GameObject*>>();
+						Case c {"Transforms (10000 nodes, depth " + std::to_string(depth) + ", " + modeName + ")"};
+						c.setup = [this, depth, nodes] {
+							*nodes = spawn({0, 0}, 10000);
+							for (std::size_t i = 0; i < nodes->size(); i++) {
+								if (i % depth == 0)
+									continue;
+								(*nodes)[i]->transform->setParent((*nodes)[i - 1]->transform);
+								(*nodes)[i]->transform->position = {1.0f, 0.0f, 0.0f};
+							}
+						};
+						c.update = [this, depth, mode, nodes] {
+							for (std::size_t i = 0; i < nodes->size(); i++) {
+								auto transform = (*nodes)[i]->transform;
+								if (mode == Mode::ROOTS_MOVING && i % depth == 0)
+									transform->rotation.y = static_cast<float>(_frameIndex) * 0.01f;
+								else if (mode == Mode::ALL_CHANGED)
+									transform->markChanged();
+							}
+						};
+						cases.push_back(std::move(c));
+					}
+				}
+				return cases;
+			}
+
+			/** Ticking 50 chunks of 1000 moving game objects each with 1, 2, 4 and 8 threads (every chunk ticked every step) */
+			std::vector<Case> tickThreadsBenchmark() {
+				std::vector<Case> cases {};
+				for (int threadsCount : {1, 2, 4, 8}) {
+					auto gameObjects = std::make_shared<std::vector<GameObject*>>();
+					Case c {"Chunks tick (50 chunks, 1000 game objects each, " + std::to_string(threadsCount) + " threads)"};
+					c.setup = [this, threadsCount, gameObjects] {
+						Config::CHUNK_TICK_THREADS_COUNT = threadsCount;
+						Config::CHUNK_TICK_INTERVALS = {1};
+						activateArea(4);
+						gameObjects->clear();
+						for (int i = 0; i < 50; i++) {
+							auto chunkGameObjects = spawn({i % 9 - 4, i / 9 - 4}, 1000);
+							gameObjects->insert(gameObjects->end(), chunkGameObjects.begin(), chunkGameObjects.end());
+						}
+					};
+					c.update = [this, gameObjects] {
+						for (auto go : *gameObjects)
+							go->transform->rotation.y = static_cast<float>(_frameIndex) * 0.01f;
+					};
+					cases.push_back(std::move(c));
+				}
+				return cases;
+			}
+
+			/**
+			 * Scene frame with 200 moving game objects in every chunk at loaded distances 3, 6 and 12, with the configured
+			 * tick intervals of the outer chunks and with every chunk ticked every step
+			 */
+			std::vector<Case> simulationLODBenchmark() {
+				std::vector<Case> cases {};
+				for (int radius : {3, 6, 12}) {
+					for (bool lod : {false, true}) {
+						auto gameObjects = std::make_shared<std::vector<GameObject*>>();
+						Case c {"Simulation LOD (loaded distance " + std::to_string(radius) + ", " + (lod ? "tick intervals" : "every chunk ticked") + ")"};
+						c.setup = [this, radius, lod, gameObjects] {
+							if (!lod)
+								Config::CHUNK_TICK_INTERVALS = {1};
+							activateArea(radius);
+							gameObjects->clear();
+							for (int x = -radius; x <= radius; x++) {
+								for (int y = -radius; y <= radius; y++) {
+									auto chunkGameObjects = spawn({x, y}, 200);
+									gameObjects->insert(gameObjects->end(), chunkGameObjects.begin(), chunkGameObjects.end());
+								}
+							}
+						};
+						c.update = [this, gameObjects] {
+							for (auto go : *gameObjects)
+								go->transform->rotation.y = static_cast<float>(_frameIndex) * 0.01f;
+						};
+						cases.push_back(std::move(c));
+					}
+				}
+				return cases;
+			}
+
+			/** Deletion of every other game object of a chunk of 10k and 100k game objects at once (as a despawned crowd) */
+			std::vector<Case> deletionBenchmark() {
+				std::vector<Case> cases {};
+				for (std::size_t count : {10000, 100000}) {
+					Case c {"Deletion (" + std::to_string(count / 2) + " of " + std::to_string(count) + " game objects)"};
+					c.measureFrames = false;
+					c.setup = [this, count] {
+						// The removed game objects are deleted at the start of the chunk simulation step (skipped here)
+						auto chunk = _scene->getChunkSync({0, 0});
+						chunk->preSimulate(0.0f, false);
+						std::size_t initialCount = chunk->getGameObjects().size();
+						std::vector<double> times {};
+						for (int i = 0; i < ITERATIONS; i++) {
+							auto gameObjects = spawn({0, 0}, count);
+							for (std::size_t j = 0; j < gameObjects.size(); j += 2)
+								chunk->removeGameObject(gameObjects[j]);
+
+							auto start = std::chrono::steady_clock::now();
+							chunk->preSimulate(0.0f, false);
+							times.push_back(std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count());
+							check(chunk->getGameObjects().size() == initialCount + count / 2);
+
+							despawnAll();
+							chunk->preSimulate(0.0f, false);
+						}
+						std::sort(times.begin(), times.end());
+						double deletion = times[times.size() / 2];
+						std::cout << "  Deletion (" << count / 2 << " of " << count << " game objects) : " << deletion << " ms ("
+						          << deletion * 1e6 / static_cast<double>(count / 2) << " ns per deleted game object, median of " << ITERATIONS << " runs)" << std::endl;
+					};
+					cases.push_back(std::move(c));
+				}
+				return cases;
+			}
+
+
+			static void check(bool condition) {
+				if (!condition)
+					throw WdeException(LogChannel::SCENE, "Benchmark failed : unexpected scene state.");
+			}
+	};
+}
+
+
+int main(int argc, char* argv[]) {
+	// Benchmark options, the other options are read by the engine
+	std::string benchmark {};
+	std::size_t framesCount = 100;
+	bool hasSteps = false;
+	std::vector<char*> engineArgs {argv[0]};
+	for (int i = 1; i < argc; i++) {
+		if (std::strcmp(argv[i], "--benchmark") == 0 && i + 1 < argc)
+			benchmark = argv[++i];
+		else if (std::strcmp(argv[i], "--frames") == 0 && i + 1 < argc)
+			framesCount = std::strtoul(argv[++i], nullptr, 10);
+		else {
+			hasSteps = hasSteps || std::strcmp(argv[i], "--steps") == 0;
+			engineArgs.push_back(argv[i]);
+		}
+	}
+	if (benchmark.empty() || framesCount == 0) {
+		std::cout << "Usage : SceneBenchmark --headless --scene <scene.json> --benchmark <name|all> [--frames <count>] [--steps <count>]" << std::endl;
+		return 2;
+	}
+
+	try {
+		tests::SceneBenchmark instance {benchmark, framesCount};
+		std::string steps = std::to_string(instance.getRequiredSteps());
+		std::string stepsOption = "--steps";
+		if (!hasSteps) {
+			engineArgs.push_back(stepsOption.data());
+			engineArgs.push_back(steps.data());
+		}
+		instance.startInstance(static_cast<int>(engineArgs.size()), engineArgs.data());
+		return instance.isDone() ? 0 : 1;
+	}
+	catch (const std::exception& e) {
+		std::cout << e.what() << std::endl;
+		return 1;
+	}
+}
@@ -0,0 +1,117 @@
+#include "../src/WaterDropEngine/WdeCommon/WdeUtils/TransformBatchKernels.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <vector>
+
+/**
+ * Checks that the SSE4.1 and AVX2 transform batch kernels compute the same matrices as the scalar kernel,
+ * and prints the duration of each kernel.
+ * Usage : TransformBatchKernelsTest [transforms count] [iterations]
+ */
+namespace {
+	using namespace wde::kernels;
+	using Kernel = void (*)(const TRSArrays&, std::size_t, std::size_t, float*);
+
+	/** Maximum error relative to the scalar matrices (absolute below 1) */
+	constexpr double MAX_ERROR = 1e-4;
+
+	/** Random transforms (rotations up to several turns, so that the range reduction of the SIMD sines is tested) */
+	struct Transforms {
+		std::vector<float> components[9];
+
+		Transforms(std::size_t count, uint32_t seed) {
+			std::mt19937 random(seed);
+			std::uniform_real_distribution<float> positions(-1000.0f, 1000.0f);
+			std::uniform_real_distribution<float> rotations(-20.0f, 20.0f);
+			std::uniform_real_distribution<float> scales(0.01f, 10.0f);
+			for (int c = 0; c < 9; c++) {
+				components[c].resize(count);
+				for (auto& value : components[c])
+					value = c < 3 ? positions(random) : (c < 6 ? rotations(random) : scales(random));
+			}
+		}
+
+		TRSArrays getArrays() const {
+			return {
+				components[0].data(), components[1].data(), components[2].data(),
+				components[3].data(), components[4].data(), components[5].data(),
+				components[6].data(), components[7].data(), components[8].data()
+			};
+		}
+	};
+
+	/** @return The average duration of a kernel call over the whole batch (in milliseconds) */
+	double time(Kernel kernel, const TRSArrays& input, std::size_t count, int iterations, std::vector<float>& matrices) {
+		kernel(input, 0, count, matrices.data()); // Warm up
+		auto start = std::chrono::steady_clock::now();
+		for (int i = 0; i < iterations; i++)
+			kernel(input, 0, count, matrices.data());
+		return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count() / iterations;
+	}
+
+	/** @return The maximum error between two matrices arrays */
+	double maxError(const std::vector<float>& expected, const std::vector<float>& actual) {
+		double error = 0.0;
+		for (std::size_t i = 0; i < expected.size(); i++)
+			error = std::max(error, std::fabs(static_cast<double>(actual[i]) - expected[i]) / std::max(1.0, std::fabs(static_cast<double>(expected[i]))));
+		return error;
+	}
+
+	/** @return True if a kernel computes the same matrices as the scalar kernel on a sub-range (unaligned start and remainder) */
+	bool checkRange(Kernel kernel, const TRSArrays& input, std::size_t count) {
+		std::size_t begin = std::min<std::size_t>(3, count);
+		std::size_t end = count > begin + 5 ? count - 5 : count;
+		std::vector<float> expected(count * 16, -1.0f);
+		std::vector<float> actual(count * 16, -1.0f);
+		composeTRSScalar(input, begin, end, expected.data());
+		kernel(input, begin, end, actual.data());
+		// The matrices outside of the range must not be written
+		for (std::size_t i = 0; i < begin * 16; i++)
+			if (actual[i] != -1.0f)
+				return false;
+		for (std::size_t i = end * 16; i < count * 16; i++)
+			if (actual[i] != -1.0f)
+				return false;
+		return maxError(expected, actual) <= MAX_ERROR;
+	}
+}
+
+int main(int argc, char** argv) {
+	std::size_t count = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 100003;
+	int iterations = argc > 2 ? std::atoi(argv[2]) : 50;
+	if (count == 0 || iterations <= 0) {
+		std::printf("Usage : TransformBatchKernelsTest [transforms count > 0] [iterations > 0]\n");
+		return 2;
+	}
+
+	Transforms transforms(count, 42);
+	TRSArrays input = transforms.getArrays();
+	std::vector<float> expected(count * 16);
+	double scalarTime = time(composeTRSScalar, input, count, iterations, expected);
+	std::printf("%zu transforms, %d iterations\n", count, iterations);
+	std::printf("  Scalar : %8.3f ms\n", scalarTime);
+
+	struct { const char* name; Kernel kernel; bool supported; } kernels[] = {
+		{ "SSE4.1", composeTRSSSE4, isSSE4Supported() },
+		{ "AVX2  ", composeTRSAVX2, isAVX2Supported() }
+	};
+	bool passed = true;
+	for (const auto& k : kernels) {
+		if (!k.supported) {
+			std::printf("  %s : not supported by the CPU, skipped\n", k.name);
+			continue;
+		}
+		std::vector<float> matrices(count * 16);
+		double kernelTime = time(k.kernel, input, count, iterations, matrices);
+		double error = maxError(expected, matrices);
+		bool valid = error <= MAX_ERROR && checkRange(k.kernel, input, count);
+		std::printf("  %s : %8.3f ms (x%.2f), max error %.2e %s\n", k.name, kernelTime, scalarTime / kernelTime, error, valid ? "OK" : "FAILED");
+		passed = passed && valid;
+	}
+	return passed ? 0 : 1;
+}